@@ -0,0 +1,1200 @@
+/**
+ * @file main.c
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief This file measure throughput of Param library hot paths
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Param.h"
+#include "ParamBulk.h"
+#include "ParamFile.h"
+#include "ParamBinary.h"
+#include "ParamTape.h"
+#include "ParamSet.h"
+#include "ParamSort.h"
+
+#if __PARAM_BULK
+    #include <unistd.h>
+#endif
+
+#define PRINTF                      printf
+
+#define BENCH_FIELDS                400
+#define BENCH_ROUNDS                2000
+#define BENCH_CHUNK                 64
+#define BENCH_KEYS                  60
+#define BENCH_ROWS                  400
+#define BENCH_STRINGS               40
+#define BENCH_WARMUP                20
+#define BENCH_REPEAT                5
+#define BENCH_REPEAT_MAX            32
+#define BENCH_BULK_SIZE             (8 * 1024 * 1024)
+#define BENCH_BULK_THREADS          64
+
+typedef void (*Bench_Fn)(char* line, Str_LenType len);
+
+typedef struct {
+    int32_t     Id;
+    float       Value;
+    char*       Name;
+    uint8_t     Enable;
+} Bench_Command;
+/**
+ * @brief command line options, ex: Param-Bench --json --rounds 500 --filter floats
+ */
+typedef struct {
+    const char* Filter;     /**< run only benchmarks that name or dataset contain it */
+    const char* Dataset;    /**< current dataset */
+    int         Warmup;     /**< untimed rounds before measure */
+    int         Rounds;     /**< rounds of each repeat */
+    int         Repeat;     /**< number of measures, best and median are reported */
+    uint8_t     Json;
+    uint8_t     First;
+} Bench_Options;
+
+double Bench_now(void);
+uint8_t Bench_enabled(const char* name);
+void Bench_section(const char* dataset, size_t len, int fields);
+void Bench_report(const char* name, size_t len, size_t fields, int rounds, double* times, int repeat);
+void Bench_run(const char* name, Bench_Fn fn, const char* line, Str_LenType len, int fields, int scale);
+void Bench_tokenizeBytewise(char* line, Str_LenType len);
+void Bench_tokenizeScan(char* line, Str_LenType len);
+void Bench_next(char* line, Str_LenType len);
+void Bench_nextView(char* line, Str_LenType len);
+void Bench_parseAll(char* line, Str_LenType len);
+void Bench_index(char* line, Str_LenType len);
+void Bench_nextLazy(char* line, Str_LenType len);
+void Bench_parseTape(char* line, Str_LenType len);
+void Bench_nextTape(char* line, Str_LenType len);
+void Bench_feedRescan(char* line, Str_LenType len);
+void Bench_feed(char* line, Str_LenType len);
+void Bench_commandsNext(char* line, Str_LenType len);
+void Bench_commandsInto(char* line, Str_LenType len);
+void Bench_keysLinear(char* line, Str_LenType len);
+void Bench_keys(char* line, Str_LenType len, uint8_t lazy);
+void Bench_keysFind(char* line, Str_LenType len);
+void Bench_keysFindLazy(char* line, Str_LenType len);
+void Bench_tableRows(char* line, Str_LenType len);
+void Bench_tableColumns(char* line, Str_LenType len);
+void Bench_tableFilter(char* line, Str_LenType len);
+void Bench_tableFiltered(char* line, Str_LenType len);
+void Bench_floatsStr(char* line, Str_LenType len);
+void Bench_toStr(char* line, Str_LenType len);
+void Bench_toStrLine(char* line, Str_LenType len);
+void Bench_toStrStr(char* line, Str_LenType len);
+void Bench_toBinary(char* line, Str_LenType len);
+void Bench_fromBinary(char* line, Str_LenType len);
+void Bench_distinctCompare(char* line, Str_LenType len);
+void Bench_distinctSet(char* line, Str_LenType len);
+void Bench_sortQsort(char* line, Str_LenType len);
+void Bench_sortRadix(char* line, Str_LenType len);
+void Bench_load(const char* line, Str_LenType len);
+size_t Bench_records(char* text, size_t size);
+void Bench_bulk(void);
+void Bench_file(void);
+
+static Bench_Options Bench_options = { NULL, "", BENCH_WARMUP, BENCH_ROUNDS, BENCH_REPEAT, 0, 1 };
+static volatile uint32_t Bench_sink;
+static Param Bench_values[BENCH_FIELDS];
+static Param_Value Bench_valuesLine[BENCH_FIELDS];
+static Param_LenType Bench_valuesLen;
+#if PARAM_TAPE
+static uint64_t Bench_tapeWords[BENCH_FIELDS * 2 + 1];
+static Param_Tape Bench_tape;
+static char Bench_tapeLine[BENCH_FIELDS * 24];
+#endif
+#if PARAM_BINARY
+static uint8_t Bench_binary[BENCH_FIELDS * 32];
+static Str_LenType Bench_binaryLen;
+#endif
+static const Param_Field Bench_commandFields[] = {
+    PARAM_FIELD(Int32, Bench_Command, Id),
+    PARAM_FIELD(Float, Bench_Command, Value),
+    PARAM_FIELD(String, Bench_Command, Name),
+    PARAM_FIELD(StateKey, Bench_Command, Enable),
+};
+static const Param_Schema Bench_commandSchema = {
+    Bench_commandFields, sizeof(Bench_commandFields) / sizeof(Bench_commandFields[0]),
+};
+
+int main(int argc, char* argv[])
+{
+    static const char* types[] = {
+        "%d", "%uu32", "0x%X", "0b1011", "%d.25", "%d.5e-3f64", "\"text %d\"",
+        "true", "false", "high", "low", "on", "off", "null", "name_%d",
+    };
+    static char line[BENCH_FIELDS * 24];
+    static char typed[BENCH_FIELDS * 24];
+    static char strings[BENCH_STRINGS * 220];
+    static char floats[BENCH_FIELDS * 24];
+    static char counters[BENCH_FIELDS * 24];
+    static char commands[BENCH_FIELDS * 24];
+    static char keys[BENCH_KEYS * 24];
+    static char table[BENCH_ROWS * 40];
+    Str_LenType len = 0;
+    Str_LenType floatsLen = 0;
+    Str_LenType countersLen = 0;
+    Str_LenType commandsLen = 0;
+    Str_LenType keysLen = 0;
+    Str_LenType tableLen = 0;
+    Str_LenType typedLen = 0;
+    Str_LenType stringsLen = 0;
+    uint32_t seed = 12345;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0) {
+            Bench_options.Json = 1;
+        }
+        else if (strcmp(argv[i], "--rounds") == 0 && i + 1 < argc) {
+            Bench_options.Rounds = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+            Bench_options.Warmup = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            Bench_options.Repeat = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            Bench_options.Filter = argv[++i];
+        }
+        else {
+            PRINTF("usage: %s [--json] [--rounds N] [--warmup N] [--repeat N] [--filter TEXT]\r\n", argv[0]);
+            return 1;
+        }
+    }
+    if (Bench_options.Rounds < 1) {
+        Bench_options.Rounds = 1;
+    }
+    if (Bench_options.Warmup < 0) {
+        Bench_options.Warmup = 0;
+    }
+    if (Bench_options.Repeat < 1 || Bench_options.Repeat > BENCH_REPEAT_MAX) {
+        Bench_options.Repeat = Bench_options.Repeat < 1 ? 1 : BENCH_REPEAT_MAX;
+    }
+
+    // many fields with mixed widths, like telemetry lines
+    for (i = 0; i < BENCH_FIELDS; i++) {
+        switch (i % 4) {
+            case 0:
+                len += sprintf(&line[len], "%d, ", i * 37);
+                break;
+            case 1:
+                len += sprintf(&line[len], "%d.%03d, ", i, i % 1000);
+                break;
+            case 2:
+                len += sprintf(&line[len], "\"sensor-%d-value\", ", i);
+                break;
+            default:
+                len += sprintf(&line[len], "parameter_name_%d, ", i);
+                break;
+        }
+    }
+    len -= 2;
+    line[len] = '\0';
+    // sensor readings with different precisions
+    for (i = 0; i < BENCH_FIELDS; i++) {
+        seed = seed * 1103515245 + 12345;
+        switch (i % 4) {
+            case 0:
+                floatsLen += sprintf(&floats[floatsLen], "%.3f,", (double) (seed >> 8) / 1000.0 - 5000.0);
+                break;
+            case 1:
+                floatsLen += sprintf(&floats[floatsLen], "%.9g,", (double) (seed >> 4) * 1e-7);
+                break;
+            case 2:
+                floatsLen += sprintf(&floats[floatsLen], "%.6e,", (double) seed * 1e-12);
+                break;
+            default:
+                floatsLen += sprintf(&floats[floatsLen], "%.17gf64,", (double) seed / 7.0);
+                break;
+        }
+    }
+    floatsLen -= 1;
+    floats[floatsLen] = '\0';
+    // counters and flags of different widths
+    for (i = 0; i < BENCH_FIELDS; i++) {
+        seed = seed * 1103515245 + 12345;
+        switch (i % 4) {
+            case 0:
+                countersLen += sprintf(&counters[countersLen], "%u,", seed >> (seed & 31));
+                break;
+            case 1:
+                countersLen += sprintf(&counters[countersLen], "-%u,", seed >> 12);
+                break;
+            case 2:
+                countersLen += sprintf(&counters[countersLen], "0x%X,", seed);
+                break;
+            default:
+                countersLen += sprintf(&counters[countersLen], "%uu32,", seed);
+                break;
+        }
+    }
+    countersLen -= 1;
+    counters[countersLen] = '\0';
+    // fixed layout commands (int32, float, string, on/off)
+    for (i = 0; i < BENCH_FIELDS / 4; i++) {
+        commandsLen += sprintf(&commands[commandsLen], "%d, %d.%02d, \"motor-%d\", %s, ", i, i % 50, i % 100, i, (i & 1) ? "on" : "off");
+    }
+    commandsLen -= 2;
+    commands[commandsLen] = '\0';
+    // key=value status, application read few of them
+    for (i = 0; i < BENCH_KEYS; i++) {
+        switch (i % 3) {
+            case 0:
+                keysLen += sprintf(&keys[keysLen], "key%d=%d.%02d,", i, i * 3, i % 100);
+                break;
+            case 1:
+                keysLen += sprintf(&keys[keysLen], "key%d=\"value %d\",", i, i);
+                break;
+            default:
+                keysLen += sprintf(&keys[keysLen], "key%d=%s,", i, (i & 1) ? "on" : "off");
+                break;
+        }
+    }
+    keysLen -= 1;
+    keys[keysLen] = '\0';
+    // every value type in turn
+    for (i = 0; i < BENCH_FIELDS; i++) {
+        typedLen += sprintf(&typed[typedLen], types[i % (sizeof(types) / sizeof(types[0]))], i);
+        typed[typedLen++] = ',';
+    }
+    typedLen -= 1;
+    typed[typedLen] = '\0';
+    // long strings
+    for (i = 0; i < BENCH_STRINGS; i++) {
+        stringsLen += sprintf(&strings[stringsLen], "\"%0*d %s\",", 100 + (i % 7) * 10, i,
+            "long text value with spaces and \\\"escaped\\\" quotes");
+    }
+    stringsLen -= 1;
+    strings[stringsLen] = '\0';
+    // CSV like records of a table
+    for (i = 0; i < BENCH_ROWS; i++) {
+        tableLen += sprintf(&table[tableLen], "%d, %d.%02d, \"motor-%d\", %s\n", i * 7, i % 50, i % 100, i, (i & 1) ? "on" : "off");
+    }
+
+    if (Bench_options.Json) {
+        PRINTF("{\n  \"library\": \"Param\",\n  \"version\": \"%d.%d.%d\",\n", PARAM_VER_MAJOR, PARAM_VER_MINOR, PARAM_VER_FIX);
+        PRINTF("  \"warmup\": %d,\n  \"rounds\": %d,\n  \"repeat\": %d,\n  \"results\": [",
+            Bench_options.Warmup, Bench_options.Rounds, Bench_options.Repeat);
+    }
+
+    Bench_section("line", (size_t) len, BENCH_FIELDS);
+    Bench_run("tokenize bytewise", Bench_tokenizeBytewise, line, len, BENCH_FIELDS, 1);
+    Bench_run("tokenize Param_scan", Bench_tokenizeScan, line, len, BENCH_FIELDS, 1);
+    Bench_run("Param_next", Bench_next, line, len, BENCH_FIELDS, 1);
+    Bench_run("Param_nextView", Bench_nextView, line, len, BENCH_FIELDS, 1);
+    Bench_run("Param_parseAll", Bench_parseAll, line, len, BENCH_FIELDS, 1);
+    Bench_run("Param_index 4 gets", Bench_index, line, len, BENCH_FIELDS, 1);
+    Bench_run("Param_nextLazy", Bench_nextLazy, line, len, BENCH_FIELDS, 1);
+    Bench_run("chunks rescan", Bench_feedRescan, line, len, BENCH_FIELDS, 1);
+    Bench_run("chunks Param_feed", Bench_feed, line, len, BENCH_FIELDS, 1);
+
+    Bench_section("types", (size_t) typedLen, BENCH_FIELDS);
+    Bench_run("types Param_next", Bench_next, typed, typedLen, BENCH_FIELDS, 1);
+    Bench_run("types Param_nextView", Bench_nextView, typed, typedLen, BENCH_FIELDS, 1);
+    Bench_run("types Param_parseAll", Bench_parseAll, typed, typedLen, BENCH_FIELDS, 1);
+    Bench_run("types Param_index 4 gets", Bench_index, typed, typedLen, BENCH_FIELDS, 1);
+    Bench_run("types Param_nextLazy", Bench_nextLazy, typed, typedLen, BENCH_FIELDS, 1);
+#if PARAM_TAPE
+    Bench_run("types Param_parseTape", Bench_parseTape, typed, typedLen, BENCH_FIELDS, 1);
+    Bench_run("types Param_nextTape", Bench_nextTape, typed, typedLen, BENCH_FIELDS, 1);
+#endif
+    Bench_load(typed, typedLen);
+    Bench_run("types Param_valueToStr", Bench_toStr, typed, typedLen, BENCH_FIELDS, 1);
+    Bench_run("types Param_toStr", Bench_toStrLine, typed, typedLen, BENCH_FIELDS, 1);
+    Bench_run("types distinct compare", Bench_distinctCompare, typed, typedLen, BENCH_FIELDS, 1);
+#if PARAM_VALUE_SET
+    Bench_run("types distinct Param_ValueSet", Bench_distinctSet, typed, typedLen, BENCH_FIELDS, 1);
+#endif
+#if PARAM_BINARY
+    Bench_run("types Param_toBinary", Bench_toBinary, typed, typedLen, BENCH_FIELDS, 1);
+    Bench_run("types Param_fromBinary", Bench_fromBinary, typed, typedLen, BENCH_FIELDS, 1);
+#endif
+
+    Bench_section("strings", (size_t) stringsLen, BENCH_STRINGS);
+    Bench_run("strings Param_next", Bench_next, strings, stringsLen, BENCH_STRINGS, 1);
+    Bench_run("strings Param_nextView", Bench_nextView, strings, stringsLen, BENCH_STRINGS, 1);
+    Bench_load(strings, stringsLen);
+    Bench_run("strings Param_toStr", Bench_toStrLine, strings, stringsLen, BENCH_STRINGS, 1);
+#if PARAM_BINARY
+    Bench_run("strings Param_toBinary", Bench_toBinary, strings, stringsLen, BENCH_STRINGS, 1);
+    Bench_run("strings Param_fromBinary", Bench_fromBinary, strings, stringsLen, BENCH_STRINGS, 1);
+#endif
+
+    Bench_section("floats", (size_t) floatsLen, BENCH_FIELDS);
+    Bench_run("floats Str_convert", Bench_floatsStr, floats, floatsLen, BENCH_FIELDS, 1);
+    Bench_run("floats Param_parseAll", Bench_parseAll, floats, floatsLen, BENCH_FIELDS, 1);
+
+    // serialize parsed values, MB/s of source line
+    Bench_load(floats, floatsLen);
+    Bench_run("floats toStr Str", Bench_toStrStr, floats, floatsLen, BENCH_FIELDS, 1);
+    Bench_run("floats Param_valueToStr", Bench_toStr, floats, floatsLen, BENCH_FIELDS, 1);
+
+    Bench_section("counters", (size_t) countersLen, BENCH_FIELDS);
+    Bench_run("counters Param_parseAll", Bench_parseAll, counters, countersLen, BENCH_FIELDS, 1);
+    Bench_load(counters, countersLen);
+    Bench_run("counters toStr Str", Bench_toStrStr, counters, countersLen, BENCH_FIELDS, 1);
+    Bench_run("counters Param_valueToStr", Bench_toStr, counters, countersLen, BENCH_FIELDS, 1);
+    Bench_run("counters sort qsort", Bench_sortQsort, counters, countersLen, BENCH_FIELDS, 1);
+#if PARAM_SORT
+    Bench_run("counters Param_sortValues", Bench_sortRadix, counters, countersLen, BENCH_FIELDS, 1);
+#endif
+
+    Bench_section("commands", (size_t) commandsLen, BENCH_FIELDS);
+    Bench_run("commands Param_next", Bench_commandsNext, commands, commandsLen, BENCH_FIELDS, 1);
+    Bench_run("commands Param_parseInto", Bench_commandsInto, commands, commandsLen, BENCH_FIELDS, 1);
+
+    Bench_section("keys", (size_t) keysLen, BENCH_KEYS);
+    Bench_run("keys linear search", Bench_keysLinear, keys, keysLen, BENCH_KEYS, 4);
+    Bench_run("keys Param_find", Bench_keysFind, keys, keysLen, BENCH_KEYS, 4);
+    Bench_run("keys Param_find lazy", Bench_keysFindLazy, keys, keysLen, BENCH_KEYS, 4);
+
+    Bench_section("table", (size_t) tableLen, BENCH_ROWS * 4);
+    Bench_run("table rows transpose", Bench_tableRows, table, tableLen, BENCH_ROWS * 4, 1);
+    Bench_run("table Param_parseColumns", Bench_tableColumns, table, tableLen, BENCH_ROWS * 4, 1);
+    Bench_run("table filter Param_parseAll", Bench_tableFilter, table, tableLen, BENCH_ROWS * 4, 1);
+    Bench_run("table Param_parseFiltered", Bench_tableFiltered, table, tableLen, BENCH_ROWS * 4, 1);
+
+    Bench_bulk();
+    Bench_file();
+
+    if (Bench_options.Json) {
+        PRINTF("\n  ]\n}\n");
+    }
+    return 0;
+}
+
+double Bench_now(void) {
+#if defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+#else
+    return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+/**
+ * @brief check filter option with name of benchmark and current dataset
+ */
+uint8_t Bench_enabled(const char* name) {
+    return Bench_options.Filter == NULL || strstr(name, Bench_options.Filter) != NULL ||
+        strstr(Bench_options.Dataset, Bench_options.Filter) != NULL;
+}
+/**
+ * @brief start a dataset, benchmarks after it report with this dataset
+ */
+void Bench_section(const char* dataset, size_t len, int fields) {
+    Bench_options.Dataset = dataset;
+    if (Bench_options.Json) {
+        return;
+    }
+    if (fields > 0) {
+        PRINTF("%s: %u bytes, %d fields\r\n", dataset, (unsigned) len, fields);
+    }
+    else {
+        PRINTF("%s: %u bytes\r\n", dataset, (unsigned) len);
+    }
+}
+static int Bench_compareTime(const void* a, const void* b) {
+    double x = *(const double*) a;
+    double y = *(const double*) b;
+    return (x > y) - (x < y);
+}
+/**
+ * @brief print result of a benchmark
+ *
+ * @param name
+ * @param len bytes of each round
+ * @param fields fields of each round
+ * @param rounds rounds of each measure
+ * @param times elapsed time of each measure, sorted in place
+ * @param repeat number of measures
+ */
+void Bench_report(const char* name, size_t len, size_t fields, int rounds, double* times, int repeat) {
+    double best;
+    double median;
+
+    qsort(times, (size_t) repeat, sizeof(double), Bench_compareTime);
+    best = times[0] / rounds;
+    median = times[repeat / 2] / rounds;
+    if (Bench_options.Json) {
+        PRINTF("%s\n    {\"dataset\": \"%s\", \"name\": \"%s\", \"bytes\": %u, \"fields\": %u, \"rounds\": %d, "
+            "\"mb_s\": %.2f, \"median_mb_s\": %.2f, \"fields_s\": %.0f, \"ns_per_field\": %.2f}",
+            Bench_options.First ? "" : ",", Bench_options.Dataset, name, (unsigned) len, (unsigned) fields, rounds,
+            (double) len / best / 1e6, (double) len / median / 1e6, (double) fields / best, best * 1e9 / (double) fields);
+        Bench_options.First = 0;
+    }
+    else {
+        PRINTF("%-28s %10.2f MB/s %10.2f Mfields/s\r\n", name, (double) len / best / 1e6, (double) fields / best / 1e6);
+    }
+}
+/**
+ * @brief run benchmark, input line copy before each round and copy time not measured
+ *
+ * @param name
+ * @param fn
+ * @param line
+ * @param len
+ * @param fields number of fields in line
+ * @param scale multiply rounds for short lines
+ */
+void Bench_run(const char* name, Bench_Fn fn, const char* line, Str_LenType len, int fields, int scale) {
+    double times[BENCH_REPEAT_MAX];
+    char* buff;
+    double start;
+    int rounds = Bench_options.Rounds * scale;
+    int r, i;
+
+    if (!Bench_enabled(name)) {
+        return;
+    }
+    buff = malloc(len + 1);
+    for (i = 0; i < Bench_options.Warmup * scale; i++) {
+        memcpy(buff, line, len + 1);
+        fn(buff, len);
+    }
+    for (r = 0; r < Bench_options.Repeat; r++) {
+        times[r] = 0;
+        for (i = 0; i < rounds; i++) {
+            memcpy(buff, line, len + 1);
+            start = Bench_now();
+            fn(buff, len);
+            times[r] += Bench_now() - start;
+        }
+    }
+    free(buff);
+
+    Bench_report(name, (size_t) len, (size_t) fields, rounds, times, Bench_options.Repeat);
+}
+/**
+ * @brief reference tokenizer, byte-at-a-time as Param_next did before Param_scan
+ */
+void Bench_tokenizeBytewise(char* line, Str_LenType len) {
+    char* pStr = line;
+    char* paramStr;
+    uint32_t count = 0;
+    (void) len;
+
+    while (pStr != NULL && *pStr != '\0') {
+        pStr = Str_ignoreWhitespace(pStr);
+        paramStr = pStr;
+        pStr = Str_indexOf(pStr, ',');
+        if (pStr != NULL) {
+            *pStr++ = '\0';
+        }
+        if (*paramStr) {
+            Str_trimRight(paramStr);
+        }
+        count += (uint8_t) *paramStr;
+    }
+    Bench_sink += count;
+}
+void Bench_tokenizeScan(char* line, Str_LenType len) {
+    const char* pStr = line;
+    const char* end = line + len;
+    uint32_t count = 0;
+
+    while (pStr < end) {
+        const char* pEnd;
+        const char* pNext;
+        while (*pStr == ' ') {
+            pStr++;
+        }
+        pEnd = Param_scan(pStr, end, ',', '\0');
+        pNext = pEnd + 1;
+        while (pEnd > pStr && *(pEnd - 1) == ' ') {
+            pEnd--;
+        }
+        count += (uint32_t)(pEnd - pStr);
+        pStr = pNext;
+    }
+    Bench_sink += count;
+}
+void Bench_next(char* line, Str_LenType len) {
+    Param_Cursor cursor;
+    Param param;
+    uint32_t count = 0;
+
+    Param_initCursor(&cursor, line, len, ',');
+    while (Param_next(&cursor, &param)) {
+        count += param.Value.Type;
+    }
+    Bench_sink += count;
+}
+void Bench_nextView(char* line, Str_LenType len) {
+    Param_Cursor cursor;
+    Param param;
+    uint32_t count = 0;
+
+    Param_initCursorView(&cursor, line, len, ',');
+    while (Param_nextView(&cursor, &param)) {
+        count += param.Value.Type;
+    }
+    Bench_sink += count;
+}
+void Bench_parseAll(char* line, Str_LenType len) {
+    static Param params[BENCH_FIELDS];
+    Param_Cursor cursor;
+
+    Param_initCursor(&cursor, line, len, ',');
+    Bench_sink += Param_parseAll(&cursor, params, BENCH_FIELDS);
+}
+/**
+ * @brief reference for chunked input, append each chunk and search whole buffer for end of line
+ */
+/**
+ * @brief index whole line and convert only 4 params, common case of reading few fields of a wide line
+ */
+void Bench_index(char* line, Str_LenType len) {
+    static const Param_LenType gets[] = { 0, BENCH_FIELDS / 4, BENCH_FIELDS / 2, BENCH_FIELDS - 1 };
+    Str_LenType offsets[BENCH_FIELDS];
+    Param_Index index;
+    Param_Value value;
+    uint32_t count = 0;
+    uint8_t i;
+
+    Param_index(&index, line, len, ',', offsets, BENCH_FIELDS);
+    for (i = 0; i < sizeof(gets) / sizeof(gets[0]); i++) {
+        if (Param_get(&index, gets[i], &value) == Param_Ok) {
+            count += value.Type;
+        }
+    }
+    Bench_sink += count;
+}
+/**
+ * @brief convert only first param and forward others as raw text
+ */
+void Bench_nextLazy(char* line, Str_LenType len) {
+    Param_Cursor cursor;
+    Param_Lazy param;
+    Param_Number num;
+    uint32_t count = 0;
+
+    Param_initCursor(&cursor, line, len, ',');
+    if (Param_nextLazy(&cursor, &param) != NULL && Param_getNumber(&param, &num) == Param_Ok) {
+        count += (uint32_t) num;
+    }
+    while (Param_nextLazy(&cursor, &param)) {
+        count += (uint32_t) param.Len;
+    }
+    Bench_sink += count;
+}
+/**
+ * @brief parse line to tape, keep tape for Bench_nextTape, strings of kept tape point into Bench_tapeLine
+ */
+void Bench_parseTape(char* line, Str_LenType len) {
+#if PARAM_TAPE
+    Param_Cursor cursor;
+
+    Param_initTape(&Bench_tape, Bench_tapeWords, sizeof(Bench_tapeWords) / sizeof(Bench_tapeWords[0]), line);
+    Param_initCursor(&cursor, line, len, ',');
+    Param_parseTape(&cursor, &Bench_tape);
+    Bench_sink += Bench_tape.Len;
+    // keep tape valid after line is freed
+    Bench_tape.Base = Bench_tapeLine;
+#else
+    (void) line;
+    (void) len;
+#endif
+}
+/**
+ * @brief decode tape of last Bench_parseTape
+ */
+void Bench_nextTape(char* line, Str_LenType len) {
+#if PARAM_TAPE
+    Param_TapeCursor cursor;
+    Param param;
+    uint32_t count = 0;
+
+    Param_initTapeCursor(&cursor, &Bench_tape);
+    while (Param_nextTapeRecord(&cursor) >= 0) {
+        while (Param_nextTape(&cursor, &param) != NULL) {
+            count += param.Value.Type;
+        }
+    }
+    Bench_sink += count;
+#endif
+    (void) line;
+    (void) len;
+}
+void Bench_feedRescan(char* line, Str_LenType len) {
+    static char buff[BENCH_FIELDS * 24];
+    Str_LenType buffLen = 0;
+    Str_LenType n;
+    Str_LenType i;
+
+    buff[0] = '\0';
+    for (i = 0; i < len; i += n) {
+        n = len - i < BENCH_CHUNK ? len - i : BENCH_CHUNK;
+        memcpy(&buff[buffLen], &line[i], n);
+        buffLen += n;
+        buff[buffLen] = '\0';
+        if (Str_indexOf(buff, '\n') != NULL) {
+            break;
+        }
+    }
+    // last chunk finish the line
+    Bench_next(buff, buffLen);
+}
+void Bench_onParam(Param_Stream* stream, Param* param) {
+    (void) stream;
+    Bench_sink += param->Value.Type;
+}
+void Bench_feed(char* line, Str_LenType len) {
+    char buff[64];
+    Param_Stream stream;
+    Str_LenType n;
+    Str_LenType i;
+
+    Param_initStream(&stream, buff, sizeof(buff), ',', '\n', Bench_onParam);
+    for (i = 0; i < len; i += n) {
+        n = len - i < BENCH_CHUNK ? len - i : BENCH_CHUNK;
+        Param_feed(&stream, &line[i], n);
+    }
+    Param_flush(&stream);
+}
+/**
+ * @brief reference for fixed layout, detect type of each param and copy it into struct
+ */
+void Bench_commandsNext(char* line, Str_LenType len) {
+    static Bench_Command cmds[BENCH_FIELDS / 4];
+    Bench_Command* cmd = cmds;
+    Param_Cursor cursor;
+    Param param;
+
+    Param_initCursor(&cursor, line, len, ',');
+    while (Param_next(&cursor, &param)) {
+        switch (param.Index & 3) {
+            case 0:
+                cmd->Id = (int32_t) param.Value.Number;
+                break;
+            case 1:
+                cmd->Value = param.Value.Type == Param_ValueType_Float ? param.Value.Float : (float) param.Value.Number;
+                break;
+            case 2:
+                cmd->Name = param.Value.String;
+                break;
+            default:
+                cmd->Enable = param.Value.StateKey;
+                cmd++;
+                break;
+        }
+    }
+    Bench_sink += (uint32_t)(cmd - cmds);
+}
+void Bench_commandsInto(char* line, Str_LenType len) {
+    static Bench_Command cmds[BENCH_FIELDS / 4];
+    Param_Cursor cursor;
+    int i = 0;
+
+    Param_initCursor(&cursor, line, len, ',');
+    while (i < BENCH_FIELDS / 4 && Param_parseInto(&cursor, &Bench_commandSchema, &cmds[i]) == Bench_commandSchema.Len) {
+        i++;
+    }
+    Bench_sink += i;
+}
+/**
+ * @brief reference for key=value, split and parse all params then search keys one by one
+ */
+void Bench_keysLinear(char* line, Str_LenType len) {
+    static const char* names[] = {"key3", "key40", "key58", "key17"};
+    char* keys[BENCH_KEYS];
+    Param_Value values[BENCH_KEYS];
+    char* pStr = line;
+    char* value;
+    int count = 0;
+    int i, j;
+    (void) len;
+
+    while (pStr != NULL && *pStr != '\0' && count < BENCH_KEYS) {
+        keys[count] = pStr;
+        pStr = Str_indexOf(pStr, ',');
+        if (pStr != NULL) {
+            *pStr++ = '\0';
+        }
+        value = Str_indexOf(keys[count], '=');
+        *value++ = '\0';
+        Param_parse(value, &values[count]);
+        count++;
+    }
+    for (i = 0; i < 4; i++) {
+        for (j = 0; j < count && Str_compare(keys[j], names[i]) != 0; j++) {}
+        Bench_sink += values[j].Type;
+    }
+}
+void Bench_keys(char* line, Str_LenType len, uint8_t lazy) {
+    static const char* names[] = {"key3", "key40", "key58", "key17"};
+    static Param_KeyValue params[BENCH_KEYS];
+    Param_KeyValues keyValues;
+    Param_Cursor cursor;
+    int i;
+
+    Param_initCursor(&cursor, line, len, ',');
+    Param_initKeyValues(&keyValues, params, BENCH_KEYS, lazy);
+    Param_parseKeyValues(&cursor, &keyValues);
+    for (i = 0; i < 4; i++) {
+        Bench_sink += Param_find(&keyValues, names[i])->Value.Type;
+    }
+}
+void Bench_keysFind(char* line, Str_LenType len) {
+    Bench_keys(line, len, 0);
+}
+void Bench_keysFindLazy(char* line, Str_LenType len) {
+    Bench_keys(line, len, 1);
+}
+/**
+ * @brief reference float parser, tokenize and convert with Str library as Param_parseNum did before
+ */
+void Bench_floatsStr(char* line, Str_LenType len) {
+    char* pStr = line;
+    char* paramStr;
+    uint32_t count = 0;
+    float f;
+    double d;
+    (void) len;
+
+    while (pStr != NULL && *pStr != '\0') {
+        paramStr = pStr;
+        pStr = Str_indexOf(pStr, ',');
+        if (pStr != NULL) {
+            *pStr++ = '\0';
+        }
+        if (Str_indexOf(paramStr, 'f') != NULL) {
+            Str_convertDouble(paramStr, &d);
+            count += (uint32_t) d;
+        }
+        else {
+            Str_convertFloat(paramStr, &f);
+            count += (uint32_t) f;
+        }
+    }
+    Bench_sink += count;
+}
+void Bench_toStr(char* line, Str_LenType len) {
+    static char str[BENCH_FIELDS * 32];
+    Param_LenType i;
+    (void) line;
+    (void) len;
+
+    for (i = 0; i < Bench_valuesLen; i++) {
+        Bench_sink += Param_valueToStr(str, &Bench_values[i].Value);
+    }
+}
+void Bench_toStrLine(char* line, Str_LenType len) {
+    static char str[BENCH_STRINGS * 320];
+    (void) line;
+    (void) len;
+
+    Bench_sink += Param_toStr(str, Bench_valuesLine, Bench_valuesLen, ",");
+}
+/**
+ * @brief encode values of Bench_load, keep result for Bench_fromBinary
+ */
+void Bench_toBinary(char* line, Str_LenType len) {
+#if PARAM_BINARY
+    Bench_binaryLen = Param_toBinary(Bench_binary, sizeof(Bench_binary), Bench_valuesLine, Bench_valuesLen);
+    Bench_sink += (uint32_t) Bench_binaryLen;
+#endif
+    (void) line;
+    (void) len;
+}
+/**
+ * @brief decode output of last Bench_toBinary, compare with Param_parseAll on same dataset
+ */
+void Bench_fromBinary(char* line, Str_LenType len) {
+#if PARAM_BINARY
+    static Param_Value values[BENCH_FIELDS];
+
+    Bench_sink += (uint32_t) Param_fromBinary(Bench_binary, Bench_binaryLen, values, BENCH_FIELDS);
+#endif
+    (void) line;
+    (void) len;
+}
+/**
+ * @brief count distinct values of Bench_load with pairwise Param_compareValue
+ */
+void Bench_distinctCompare(char* line, Str_LenType len) {
+    uint32_t count = 0;
+    Param_LenType i, j;
+    (void) line;
+    (void) len;
+
+    for (i = 0; i < Bench_valuesLen; i++) {
+        for (j = 0; j < i && !Param_compareValue(&Bench_valuesLine[i], &Bench_valuesLine[j]); j++) {}
+        count += j == i;
+    }
+    Bench_sink += count;
+}
+/**
+ * @brief count distinct values of Bench_load with value set, strings copy to arena
+ */
+void Bench_distinctSet(char* line, Str_LenType len) {
+#if PARAM_VALUE_SET
+    static Param_ValueEntry entries[BENCH_FIELDS * 4];
+    static char arena[BENCH_FIELDS * 24];
+    Param_ValueSet set;
+    Param_LenType i;
+
+    Param_initValueSet(&set, entries, BENCH_FIELDS * 4, arena, sizeof(arena));
+    for (i = 0; i < Bench_valuesLen; i++) {
+        Param_addValue(&set, &Bench_valuesLine[i]);
+    }
+    Bench_sink += set.Len;
+#endif
+    (void) line;
+    (void) len;
+}
+/**
+ * @brief qsort comparator with Param_orderValue
+ */
+static int Bench_orderValue(const void* a, const void* b) {
+    return Param_orderValue((const Param_Value*) a, (const Param_Value*) b);
+}
+/**
+ * @brief sort copy of values of Bench_load with qsort and comparator
+ */
+void Bench_sortQsort(char* line, Str_LenType len) {
+    static Param_Value values[BENCH_FIELDS];
+    (void) line;
+    (void) len;
+
+    memcpy(values, Bench_valuesLine, Bench_valuesLen * sizeof(Param_Value));
+    qsort(values, (size_t) Bench_valuesLen, sizeof(Param_Value), Bench_orderValue);
+    Bench_sink += values[0].Type;
+}
+/**
+ * @brief sort copy of values of Bench_load with radix sort
+ */
+void Bench_sortRadix(char* line, Str_LenType len) {
+#if PARAM_SORT
+    static Param_Value values[BENCH_FIELDS];
+    static Param_SortKey keys[BENCH_FIELDS * 2];
+
+    memcpy(values, Bench_valuesLine, Bench_valuesLen * sizeof(Param_Value));
+    Param_sortValues(values, (uint32_t) Bench_valuesLen, keys);
+    Bench_sink += values[0].Type;
+#endif
+    (void) line;
+    (void) len;
+}
+/**
+ * @brief reference serializer, Str library as Param_valueToStr did before
+ */
+void Bench_toStrStr(char* line, Str_LenType len) {
+    static char str[BENCH_FIELDS * 32];
+    Param_Value* value;
+    Param_LenType i;
+    (void) line;
+    (void) len;
+
+    for (i = 0; i < Bench_valuesLen; i++) {
+        value = &Bench_values[i].Value;
+        switch (value->Type) {
+            case Param_ValueType_Double:
+                Bench_sink += Str_parseDouble(value->Double, str);
+                break;
+            case Param_ValueType_Float:
+                Bench_sink += Str_parseFloat(value->Float, str);
+                break;
+            case Param_ValueType_NumberHex:
+                Bench_sink += Str_parseLong(value->NumberHex, Str_Hex, STR_NORMAL_LEN, str);
+                break;
+            case Param_ValueType_UInt32:
+                Bench_sink += Str_parseNum(value->UInt32, Str_Decimal, STR_NORMAL_LEN, str);
+                break;
+            default:
+                Bench_sink += Str_parseLong(value->Number, Str_Decimal, STR_NORMAL_LEN, str);
+                break;
+        }
+    }
+}
+/**
+ * @brief parse line into Bench_values for serialize benchmarks, string values point into a static copy of line
+ */
+void Bench_load(const char* line, Str_LenType len) {
+    static char buff[BENCH_FIELDS * 24];
+    Param_Cursor cursor;
+    Param_LenType i;
+
+    memcpy(buff, line, len + 1);
+    Param_initCursor(&cursor, buff, len, ',');
+    Bench_valuesLen = Param_parseAll(&cursor, Bench_values, BENCH_FIELDS);
+    for (i = 0; i < Bench_valuesLen; i++) {
+        Bench_valuesLine[i] = Bench_values[i].Value;
+    }
+}
+/**
+ * @brief parse records to arrays of Param and then transpose them to columns
+ */
+void Bench_tableRows(char* line, Str_LenType len) {
+    static int64_t ids[BENCH_ROWS];
+    static double values[BENCH_ROWS];
+    static char* names[BENCH_ROWS];
+    static uint8_t enables[BENCH_ROWS];
+    Param_TableCursor table;
+    Param_Cursor cursor;
+    Param params[4];
+    int rows = 0;
+
+    Param_initTableCursor(&table, line, (size_t) len, '\n', ',');
+    while (rows < BENCH_ROWS && Param_nextRow(&table, &cursor) != NULL) {
+        if (Param_parseAll(&cursor, params, 4) == 4) {
+            ids[rows] = params[0].Value.Type == Param_ValueType_Number ? params[0].Value.Number : 0;
+            values[rows] = params[1].Value.Type == Param_ValueType_Float ? params[1].Value.Float : 0;
+            names[rows] = params[2].Value.Type == Param_ValueType_String ? params[2].Value.String : NULL;
+            enables[rows] = params[3].Value.Type == Param_ValueType_StateKey ? params[3].Value.StateKey : 0;
+        }
+        rows++;
+    }
+    Bench_sink += (uint32_t)(ids[rows - 1] + (int64_t) values[rows - 1] + enables[rows - 1] + (names[0] != NULL));
+}
+/**
+ * @brief parse records directly into typed columns
+ */
+void Bench_tableColumns(char* line, Str_LenType len) {
+    static int32_t ids[BENCH_ROWS];
+    static float values[BENCH_ROWS];
+    static char* names[BENCH_ROWS];
+    static uint8_t enables[BENCH_ROWS];
+    static uint8_t valid[4][(BENCH_ROWS + 7) / 8];
+    Param_Column column[] = {
+        PARAM_COLUMN(Int32, ids, valid[0]),
+        PARAM_COLUMN(Float, values, valid[1]),
+        PARAM_COLUMN(String, names, valid[2]),
+        PARAM_COLUMN(StateKey, enables, valid[3]),
+    };
+    Param_TableCursor table;
+    Param_Columns columns;
+    uint32_t rows;
+
+    Param_initTableCursor(&table, line, (size_t) len, '\n', ',');
+    Param_initColumns(&columns, column, 4, BENCH_ROWS);
+    rows = Param_parseColumns(&table, &columns);
+    Bench_sink += (uint32_t)(ids[rows - 1] + (int32_t) values[rows - 1] + enables[rows - 1] + (names[0] != NULL));
+}
+/**
+ * @brief keep records with id < BENCH_ROWS and enabled, parse all params and then check them
+ */
+void Bench_tableFilter(char* line, Str_LenType len) {
+    Param_TableCursor table;
+    Param_Cursor cursor;
+    Param params[4];
+    uint32_t count = 0;
+
+    Param_initTableCursor(&table, line, (size_t) len, '\n', ',');
+    while (Param_nextRow(&table, &cursor) != NULL) {
+        if (Param_parseAll(&cursor, params, 4) == 4 &&
+            params[0].Value.Type == Param_ValueType_Number && params[0].Value.Number < BENCH_ROWS &&
+            params[3].Value.Type == Param_ValueType_StateKey && params[3].Value.StateKey
+        ) {
+            count += (uint32_t) params[0].Value.Number;
+        }
+    }
+    Bench_sink += count;
+}
+/**
+ * @brief same records of Bench_tableFilter, dropped records stop at id
+ */
+void Bench_tableFiltered(char* line, Str_LenType len) {
+    Param_Condition conditions[2];
+    Param_Filter filter;
+    Param_TableCursor table;
+    Param_Cursor cursor;
+    Param params[4];
+    uint32_t count = 0;
+
+    conditions[0].Index = 0;
+    conditions[0].Op = Param_FilterOp_Less;
+    conditions[0].Value.Type = Param_ValueType_Number;
+    conditions[0].Value.Number = BENCH_ROWS;
+    conditions[1].Index = 3;
+    conditions[1].Op = Param_FilterOp_Equal;
+    conditions[1].Value.Type = Param_ValueType_StateKey;
+    conditions[1].Value.StateKey = 1;
+    Param_initFilter(&filter, conditions, 2);
+    Param_initTableCursor(&table, line, (size_t) len, '\n', ',');
+    while (Param_nextRow(&table, &cursor) != NULL) {
+        if (Param_parseFiltered(&cursor, &filter, params, 4) == 4) {
+            count += (uint32_t) params[0].Value.Number;
+        }
+    }
+    Bench_sink += count;
+}
+/**
+ * @brief fill text with records that have uneven number of fields
+ *
+ * @return size_t length of text
+ */
+size_t Bench_records(char* text, size_t size) {
+    size_t len = 0;
+    uint32_t seed = 54321;
+    int fields;
+    int i;
+
+    while (len + 4096 < size) {
+        seed = seed * 1103515245 + 12345;
+        fields = (int)((seed >> 16) % ((seed & 0x100) ? 8 : 120)) + 1;
+        for (i = 0; i < fields; i++) {
+            switch (i % 4) {
+                case 0:
+                    len += (size_t) sprintf(&text[len], "%d,", (int)(seed >> (i & 15)));
+                    break;
+                case 1:
+                    len += (size_t) sprintf(&text[len], "%d.%03d,", i, (int)(seed % 1000));
+                    break;
+                case 2:
+                    len += (size_t) sprintf(&text[len], "\"sensor-%d\",", i);
+                    break;
+                default:
+                    len += (size_t) sprintf(&text[len], "%s,", (seed & i) ? "on" : "off");
+                    break;
+            }
+        }
+        text[len - 1] = '\n';
+    }
+    text[len] = '\0';
+    return len;
+}
+/**
+ * @brief parse records of a big buffer with Param_parseBulk, scale from 1 thread to number of processors
+ */
+void Bench_bulk(void) {
+#if __PARAM_BULK
+    char* text = malloc(BENCH_BULK_SIZE + 1);
+    char* buff = malloc(BENCH_BULK_SIZE + 1);
+    Param_Records records;
+    size_t len;
+    size_t fields = 0;
+    // sysconf return -1 if number of processors is unknown
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    double times[BENCH_REPEAT_MAX];
+    double start;
+    char name[32];
+    uint8_t maxThreads = (uint8_t)(cpus < 1 ? 1 : cpus > BENCH_BULK_THREADS ? BENCH_BULK_THREADS : cpus);
+    uint8_t threads;
+    int i;
+
+    if (text == NULL || buff == NULL) {
+        fprintf(stderr, "bulk: out of memory\r\n");
+        free(buff);
+        free(text);
+        return;
+    }
+    len = Bench_records(text, BENCH_BULK_SIZE);
+    Bench_section("bulk", len, 0);
+    // 1, 2, 4, ... threads and number of processors
+    for (threads = 1; ; threads = threads * 2 < maxThreads ? threads * 2 : maxThreads) {
+        sprintf(name, "Param_parseBulk %u thr", (unsigned) threads);
+        if (Bench_enabled(name)) {
+            for (i = 0; i < Bench_options.Repeat; i++) {
+                memcpy(buff, text, len + 1);
+                start = Bench_now();
+                if (Param_parseBulk(buff, len, '\n', ',', threads, &records) != Param_Ok) {
+                    fprintf(stderr, "Param_parseBulk failed\r\n");
+                    break;
+                }
+                times[i] = Bench_now() - start;
+                fields = records.ParamsLen;
+                Bench_sink += (uint32_t) records.Len;
+                Param_freeRecords(&records);
+            }
+            if (i == Bench_options.Repeat) {
+                Bench_report(name, len, fields, 1, times, Bench_options.Repeat);
+            }
+        }
+        if (threads == maxThreads) {
+            break;
+        }
+    }
+    free(buff);
+    free(text);
+#endif
+}
+/**
+ * @brief scan records of a file, fread copy with Param_next vs mapped file with Param_nextView
+ */
+void Bench_file(void) {
+#if __PARAM_FILE
+    static const char* path = "Param-Bench-File.txt";
+    char* text = malloc(BENCH_BULK_SIZE + 1);
+    Param_File file;
+    Param_Cursor cursor;
+    Param param;
+    FILE* fp;
+    char* pStr;
+    char* pEnd;
+    size_t len = Bench_records(text, BENCH_BULK_SIZE);
+    double times[BENCH_REPEAT_MAX];
+    double start;
+    uint32_t count = 0;
+    int i;
+
+    fp = fopen(path, "wb");
+    if (fp == NULL || fwrite(text, 1, len, fp) != len) {
+        fprintf(stderr, "can not write %s\r\n", path);
+        if (fp != NULL) {
+            fclose(fp);
+        }
+        free(text);
+        return;
+    }
+    fclose(fp);
+    Bench_section("file", len, 0);
+    // read whole file and split lines
+    for (i = 0; i < Bench_options.Repeat && Bench_enabled("file fread Param_next"); i++) {
+        start = Bench_now();
+        fp = fopen(path, "rb");
+        len = fread(text, 1, BENCH_BULK_SIZE, fp);
+        fclose(fp);
+        text[len] = '\0';
+        count = 0;
+        pStr = text;
+        while (pStr != NULL) {
+            pEnd = strchr(pStr, '\n');
+            if (pEnd != NULL) {
+                *pEnd++ = '\0';
+            }
+            Param_initCursor(&cursor, pStr, Str_len(pStr), ',');
+            while (Param_next(&cursor, &param) != NULL) {
+                count++;
+            }
+            pStr = pEnd;
+        }
+        times[i] = Bench_now() - start;
+        Bench_sink += count;
+    }
+    if (i > 0) {
+        Bench_report("file fread Param_next", len, count, 1, times, i);
+    }
+    // mapped file, no copy
+    for (i = 0; i < Bench_options.Repeat && Bench_enabled("file Param_nextRecord"); i++) {
+        start = Bench_now();
+        if (Param_openFile(&file, path, '\n', ',') != Param_Ok) {
+            break;
+        }
+        count = 0;
+        while (Param_nextRecord(&file, &cursor) != NULL) {
+            while (Param_nextView(&cursor, &param) != NULL) {
+                count++;
+            }
+        }
+        Param_closeFile(&file);
+        times[i] = Bench_now() - start;
+        Bench_sink += count;
+    }
+    if (i > 0) {
+        Bench_report("file Param_nextRecord", len, count, 1, times, i);
+    }
+    remove(path);
+    free(text);
+#endif
+}
@@ -9,8 +9,16 @@
  * 
  */
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "Param.h"
+#include "ParamBulk.h"
+#include "ParamFile.h"
+#include "ParamBinary.h"
+#include "ParamTape.h"
+#include "ParamSet.h"
+#include "ParamSort.h"
 
 #define PRINTLN						puts
 #define PRINTF						printf
@@ -22,21 +30,73 @@ uint32_t assertResult = 0;
 
 #define setValue(IDX, TYPE, VAL)    values[IDX].Type = Param_ValueType_ ##TYPE;\
                                     values[IDX].TYPE = VAL
+#define setView(IDX, TYPE, VAL)     values[IDX].Type = Param_ValueType_ ##TYPE;\
+                                    values[IDX].TYPE = VAL;\
+                                    values[IDX].Len = Str_len(VAL)
 
 typedef uint32_t Test_Result;
 typedef Test_Result (*Test_Fn)(void);
 
 Test_Result Assert_Param(char* buff, Param_Value* values, int len, uint16_t cLine);
+Test_Result Assert_ParamView(const char* buff, Param_Value* values, int len, uint16_t cLine);
 Test_Result Assert_Str(const char* str1, const char* str2, uint16_t line);
 void Result_print(Test_Result result);
 void Param_print(Param* param);
 
 Test_Result Test_1(void);
 Test_Result Test_2(void);
+Test_Result Test_3(void);
+Test_Result Test_4(void);
+Test_Result Test_5(void);
+Test_Result Test_6(void);
+Test_Result Test_7(void);
+Test_Result Test_8(void);
+Test_Result Test_9(void);
+Test_Result Test_10(void);
+Test_Result Test_11(void);
+Test_Result Test_12(void);
+Test_Result Test_13(void);
+Test_Result Test_14(void);
+Test_Result Test_15(void);
+Test_Result Test_16(void);
+Test_Result Test_17(void);
+Test_Result Test_18(void);
+Test_Result Test_19(void);
+Test_Result Test_20(void);
+Test_Result Test_21(void);
+Test_Result Test_22(void);
+Test_Result Test_23(void);
+Test_Result Test_24(void);
+Test_Result Test_25(void);
+Test_Result Test_26(void);
 
 const Test_Fn Tests[] = {
     Test_1,
     Test_2,
+    Test_3,
+    Test_4,
+    Test_5,
+    Test_6,
+    Test_7,
+    Test_8,
+    Test_9,
+    Test_10,
+    Test_11,
+    Test_12,
+    Test_13,
+    Test_14,
+    Test_15,
+    Test_16,
+    Test_17,
+    Test_18,
+    Test_19,
+    Test_20,
+    Test_21,
+    Test_22,
+    Test_23,
+    Test_24,
+    Test_25,
+    Test_26,
 };
 const uint32_t Tests_Len = sizeof(Tests) / sizeof(Tests[0]);
 
@@ -271,6 +331,2060 @@ Test_Result Test_2(void) {
     return 0;
 }
 
+Test_Result Test_3(void) {
+    char TEMP1[80];
+    char TEMP2[80];
+    char TEMP3[80];
+    char BUFF[200] = "";
+    Param_Value values[10];
+
+    // long params cross vector width of the scanner
+    Str_copy(BUFF, "   this_is_a_long_unknown_parameter_that_needs_more_than_one_block   ,\t 123456789 ,,"
+                   "\"a string that is long enough to cross two 32 bytes blocks\"   ,   tail_param_without_separator  ");
+    Str_copy(TEMP1, "this_is_a_long_unknown_parameter_that_needs_more_than_one_block");
+    Str_copy(TEMP2, "a string that is long enough to cross two 32 bytes blocks");
+    Str_copy(TEMP3, "tail_param_without_separator");
+    setValue(0, Unknown, TEMP1);
+    setValue(1, Number, 123456789);
+    setValue(2, Unknown, "");
+    setValue(3, String, TEMP2);
+    setValue(4, Unknown, TEMP3);
+    assert(Param, BUFF, values, 5);
+    // lines longer than cursor length, unknown (0) and wrapped lengths scan up to null terminator
+    {
+        static const uint32_t lens[] = { 35001, 50001, 65537 };
+        Param_Cursor cursor;
+        Param param;
+        char* line;
+        uint32_t count;
+        uint32_t total;
+        uint32_t i, j;
+
+        for (i = 0; i < ARRAY_LEN(lens) * 2; i++) {
+            // exact size, so reads after null terminator are caught by sanitizers
+            line = (char*) malloc(lens[i / 2] * 2 + 1);
+            if (line == NULL) {
+                return __LINE__ << 16;
+            }
+            for (j = 0; j < lens[i / 2]; j++) {
+                memcpy(&line[j * 2], "7,", 2);
+            }
+            line[lens[i / 2] * 2] = '\0';
+            Param_initCursor(&cursor, line, (i & 1) ? Str_len(line) : 0, ',');
+            count = 0;
+            total = 0;
+            while (Param_next(&cursor, &param) != NULL) {
+                count += param.Value.Type == Param_ValueType_Number && param.Value.Number == 7;
+                total++;
+            }
+            free(line);
+            // trailing separator has no empty param same as short lines
+            if (count != lens[i / 2] || total != count) {
+                return (__LINE__ << 16) | i;
+            }
+        }
+    }
+
+    return 0;
+}
+
+Test_Result Test_4(void) {
+    char BUFF[200] = "";
+    Param params[40];
+    Param_ValueType types[40];
+    Param_ValueData datas[40];
+    Param_Cursor cursor;
+    Param_LenType len;
+    Param_LenType i;
+
+    // more params than one batch
+    for (i = 0; i < 40; i++) {
+        Str_parseNum(i, Str_Decimal, STR_NORMAL_LEN, &BUFF[i * 3]);
+        if (i < 10) {
+            BUFF[i * 3 + 1] = ' ';
+        }
+        BUFF[i * 3 + 2] = ',';
+    }
+    BUFF[40 * 3 - 1] = '\0';
+
+    Param_initCursor(&cursor, BUFF, Str_len(BUFF), ',');
+    len = Param_parseAll(&cursor, params, 35);
+    if (len != 35) {
+        return __LINE__ << 16 | len;
+    }
+    len = Param_parseAll(&cursor, &params[35], 10);
+    if (len != 5) {
+        return __LINE__ << 16 | len;
+    }
+    for (i = 0; i < 40; i++) {
+        if (params[i].Index != i || params[i].Value.Type != Param_ValueType_Number || params[i].Value.Number != i) {
+            return __LINE__ << 16 | i;
+        }
+    }
+
+    Str_copy(BUFF, "12, \"Ali\", 2.5, high");
+    Param_initCursor(&cursor, BUFF, Str_len(BUFF), ',');
+    len = Param_parseAllValues(&cursor, types, datas, 10);
+    if (len != 4 || cursor.Index != 4) {
+        return __LINE__ << 16 | len;
+    }
+    if (types[0] != Param_ValueType_Number || datas[0].Number != 12 ||
+        types[1] != Param_ValueType_String || Str_compare(datas[1].String, "Ali") != 0 ||
+        types[2] != Param_ValueType_Float || datas[2].Float != 2.5f ||
+        types[3] != Param_ValueType_State || datas[3].State != 1) {
+        return __LINE__ << 16;
+    }
+
+    return 0;
+}
+
+Test_Result Test_5(void) {
+    Param_Value values[10];
+
+    setValue(0, Number, 12);
+    setView(1, StringView, "Ali");
+    setValue(2, Float, 2.5f);
+    setValue(3, StateKey, 0);
+    setView(4, NullView, "NULL");
+    setView(5, UnknownView, "Boo");
+    setValue(6, State, 1);
+    assert(ParamView, "12, \"Ali\", 2.5,Off , NULL,Boo,HIGH", values, 7);
+
+    setValue(0, NumberHex, 0x10);
+    setValue(1, NumberBinary, 7);
+    setValue(2, UInt8, 13);
+    setView(3, StringView, "a\\\"b");
+    setView(4, UnknownView, "\"open");
+    setView(5, UnknownView, "");
+    setValue(6, Boolean, 1);
+    assert(ParamView, "0x10,0b0111,13u8,\"a\\\"b\",\"open,,True", values, 7);
+
+    setView(0, UnknownView, "12x8");
+    setView(1, UnknownView, "null p");
+    assert(ParamView, "12x8, null p", values, 2);
+
+    // views serialize without null terminator
+    {
+        const char* line = "\"Ali\",Boo,null,\"x\"";
+        char str[40];
+        Param_Cursor cursor;
+        Param params[4];
+        Param_LenType len = 0;
+
+        Param_initCursorView(&cursor, line, 14, ',');
+        while (Param_nextView(&cursor, &params[len])) {
+            values[len] = params[len].Value;
+            len++;
+        }
+        Param_toStr(str, values, len, ",");
+        assert(Str, str, "\"Ali\",Boo,Null");
+    }
+
+    return 0;
+}
+
+Test_Result Test_6(void) {
+    char BUFF[200] = "";
+    Param_Value values[10];
+
+    // number grammar, suffix and range
+    Str_copy(BUFF, "-12, 18446744073709551615u, -9223372036854775808, 9223372036854775808, 300u8x, 250u8, 7i64");
+    setValue(0, Number, -12);
+    setValue(1, UNumber, 18446744073709551615ULL);
+    setValue(2, Number, INT64_MIN);
+    setValue(3, Unknown, "9223372036854775808");
+    setValue(4, Unknown, "300u8x");
+    setValue(5, UInt8, 250);
+    setValue(6, Int64, 7);
+    assert(Param, BUFF, values, 7);
+
+    // floats, exponent and suffix
+    Str_copy(BUFF, "2.5e3, 1.25e-2f64, 2.5u8, 0.1, 1e5, -.5, 1.5f32, 0x1G, 1e, 3.25f64");
+    setValue(0, Float, 2500.0f);
+    setValue(1, Double, 0.0125);
+    setValue(2, Float, 2.5f);
+    setValue(3, Float, 0.1f);
+    setValue(4, Float, 100000.0f);
+    setValue(5, Float, -0.5f);
+    setValue(6, Float, 1.5f);
+    setValue(7, Unknown, "0x1G");
+    setValue(8, Unknown, "1e");
+    setValue(9, Double, 3.25);
+    assert(Param, BUFF, values, 10);
+
+    // view mode parse numbers without copy
+    setValue(0, Double, 0.000123456789);
+    setValue(1, NumberHex, 0xABCDEF);
+    setView(2, UnknownView, "1.2.3");
+    assert(ParamView, "123456789e-12f64, 0xabcdef, 1.2.3", values, 3);
+
+    return 0;
+}
+
+Test_Result Test_7(void) {
+    // round trip corpus, expected bits are nearest value with round half to even
+    static const struct {
+        const char* Str;
+        uint64_t    Double;
+        uint32_t    Float;
+    } CORPUS[] = {
+        { "2.2250738585072011e-308", 0x000FFFFFFFFFFFFFULL, 0x00000000UL },
+        { "4.9406564584124654e-324", 0x0000000000000001ULL, 0x00000000UL },
+        { "2.4703282292062328e-324", 0x0000000000000001ULL, 0x00000000UL },
+        { "1.7976931348623157e308", 0x7FEFFFFFFFFFFFFFULL, 0x7F800000UL },
+        { "9007199254740993", 0x4340000000000000ULL, 0x5A000000UL },
+        { "1e23", 0x44B52D02C7E14AF6ULL, 0x65A96816UL },
+        { "8.589973e9", 0x42000004B0400000ULL, 0x50000026UL },
+        { "7.038531e-26", 0x3AB5C87FB0000000ULL, 0x15AE43FDUL },
+        { "1.00000017881393432617187499", 0x3FF0000030000000ULL, 0x3F800001UL },
+        { "1.000000178813934326171875", 0x3FF0000030000000ULL, 0x3F800002UL },
+        { "3.4028235677973366e38", 0x47EFFFFFF0000000ULL, 0x7F7FFFFFUL },
+        { "1.4012984643e-45", 0x369FFFFFFFFD90E2ULL, 0x00000001UL },
+        { "123456789012345678901234567890", 0x45F8EE90FF6C373EULL, 0x6FC77488UL },
+        { "-0.000000000000000000000000000000000000011754942807573642917", 0xB80FFFFFE0000000ULL, 0x807FFFFFUL },
+        { "0.1", 0x3FB999999999999AULL, 0x3DCCCCCDUL },
+        { "-2.5e-3", 0xBF647AE147AE147BULL, 0xBB23D70AUL },
+    };
+    char BUFF[80];
+    Param_Value value;
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    uint64_t bits;
+    uint32_t bits32;
+    Str_LenType len;
+    int i;
+
+    for (i = 0; i < (int) ARRAY_LEN(CORPUS); i++) {
+        len = sprintf(BUFF, "%sf64", CORPUS[i].Str);
+        if (Param_parseView(BUFF, len, &value) != Param_Ok || value.Type != Param_ValueType_Double ||
+            memcmp(&value.Double, &CORPUS[i].Double, sizeof(bits)) != 0) {
+            return __LINE__ << 16 | i;
+        }
+        len = sprintf(BUFF, "%sf", CORPUS[i].Str);
+        if (Param_parseView(BUFF, len, &value) != Param_Ok || value.Type != Param_ValueType_Float ||
+            memcmp(&value.Float, &CORPUS[i].Float, sizeof(bits32)) != 0) {
+            return __LINE__ << 16 | i;
+        }
+    }
+    // random bits must survive print and parse
+    for (i = 0; i < 100000; i++) {
+        double d;
+        float f;
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        bits = seed & 0x7FEFFFFFFFFFFFFFULL;
+        memcpy(&d, &bits, sizeof(d));
+        len = sprintf(BUFF, "%.17gf64", d);
+        Param_parseView(BUFF, len, &value);
+        if (memcmp(&value.Double, &d, sizeof(d)) != 0) {
+            PRINTF("%s\r\n", BUFF);
+            return __LINE__ << 16;
+        }
+        bits32 = (uint32_t) seed & 0x7F7FFFFFUL;
+        memcpy(&f, &bits32, sizeof(f));
+        len = sprintf(BUFF, "%.9g", f);
+        Param_parseView(BUFF, len, &value);
+        if (value.Type == Param_ValueType_Float && memcmp(&value.Float, &f, sizeof(f)) != 0) {
+            PRINTF("%s\r\n", BUFF);
+            return __LINE__ << 16;
+        }
+    }
+
+    return 0;
+}
+
+Test_Result Test_8(void) {
+    char str[80];
+    Param_Value values[10];
+    Param_Value value;
+    uint64_t seed = 0x2545F4914F6CDD1DULL;
+    Str_LenType len;
+    int i;
+
+    // shortest digits, fixed or scientific notation
+    setValue(0, Float, 0.1f);
+    setValue(1, Float, 1e20f);
+    setValue(2, Float, 1.0f);
+    setValue(3, Float, -0.0f);
+    setValue(4, Float, 1.5e-7f);
+    setValue(5, Float, 0.00125f);
+    setValue(6, Double, 0.1);
+    setValue(7, Double, 5e-324);
+    setValue(8, Double, 123456.789);
+    setValue(9, Double, 1250000.0);
+    Param_toStr(str, values, 10, ",");
+    assert(Str, str, "0.1,1e20,1.0,-0.0,1.5e-7,0.00125,0.1f64,5e-324f64,123456.789f64,1250000.0f64");
+
+    // output must parse back to same type and bits
+    for (i = 0; i < 100000; i++) {
+        uint64_t bits;
+        uint32_t bits32;
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        bits = seed & 0xFFEFFFFFFFFFFFFFULL;
+        bits32 = (uint32_t) seed & 0xFF7FFFFFUL;
+        value.Type = Param_ValueType_Double;
+        memcpy(&value.Double, &bits, sizeof(bits));
+        len = Param_valueToStr(str, &value);
+        if (Param_parseView(str, len, &values[0]) != Param_Ok || values[0].Type != Param_ValueType_Double ||
+            memcmp(&values[0].Double, &bits, sizeof(bits)) != 0) {
+            PRINTF("%s\r\n", str);
+            return __LINE__ << 16;
+        }
+        value.Type = Param_ValueType_Float;
+        memcpy(&value.Float, &bits32, sizeof(bits32));
+        len = Param_valueToStr(str, &value);
+        if (Param_parseView(str, len, &values[0]) != Param_Ok || values[0].Type != Param_ValueType_Float ||
+            memcmp(&values[0].Float, &bits32, sizeof(bits32)) != 0) {
+            PRINTF("%s\r\n", str);
+            return __LINE__ << 16;
+        }
+    }
+    // infinite and NaN parse back, NaN keep only NaN-ness
+    {
+        static const uint64_t doubleBits[] = { 0x7FF0000000000000ULL, 0xFFF0000000000000ULL, 0x7FF8000000000000ULL };
+        static const uint32_t floatBits[] = { 0x7F800000UL, 0xFF800000UL, 0x7FC00000UL };
+        char buff[48];
+        Param_Cursor cursor;
+        Param param;
+
+        for (i = 0; i < 3; i++) {
+            value.Type = Param_ValueType_Double;
+            memcpy(&value.Double, &doubleBits[i], sizeof(doubleBits[i]));
+            len = Param_valueToStr(str, &value);
+            if (Param_parseView(str, len, &values[0]) != Param_Ok || values[0].Type != Param_ValueType_Double ||
+                (i < 2 ? memcmp(&values[0].Double, &doubleBits[i], sizeof(doubleBits[i])) != 0 : values[0].Double == values[0].Double)) {
+                PRINTF("%s\r\n", str);
+                return (__LINE__ << 16) | i;
+            }
+            value.Type = Param_ValueType_Float;
+            memcpy(&value.Float, &floatBits[i], sizeof(floatBits[i]));
+            len = Param_valueToStr(str, &value);
+            strcpy(buff, str);
+            Param_initCursor(&cursor, buff, len, ',');
+            if (Param_next(&cursor, &param) == NULL || param.Value.Type != Param_ValueType_Float ||
+                (i < 2 ? memcmp(&param.Value.Float, &floatBits[i], sizeof(floatBits[i])) != 0 : param.Value.Float == param.Value.Float)) {
+                PRINTF("%s\r\n", str);
+                return (__LINE__ << 16) | i;
+            }
+        }
+        setValue(0, Float, 0.0f);
+        memcpy(&values[0].Float, &floatBits[1], sizeof(floatBits[1]));
+        setValue(1, Double, 0.0);
+        memcpy(&values[1].Double, &doubleBits[0], sizeof(doubleBits[0]));
+        Param_toStr(str, values, 2, ",");
+        assert(Str, str, "-Inf,Inff64");
+        // other words are still unknown
+        if (Param_parseView("Info", 4, &values[0]) == Param_Ok || Param_parseView("-NaN", 4, &values[0]) == Param_Ok) {
+            return __LINE__ << 16;
+        }
+    #if PARAM_CASE_MODE == PARAM_CASE_INSENSITIVE
+        // words are case insensitive same as keywords
+        strcpy(buff, "inf, INF, -inf, nan, NAN, -INFf64, nanf64");
+        Param_initCursor(&cursor, buff, Str_len(buff), ',');
+        for (i = 0; i < 7; i++) {
+            if (Param_next(&cursor, &param) == NULL ||
+                param.Value.Type != (i < 5 ? Param_ValueType_Float : Param_ValueType_Double) ||
+                (i == 2 ? memcmp(&param.Value.Float, &floatBits[1], sizeof(floatBits[1])) != 0 :
+                 i < 2 ? memcmp(&param.Value.Float, &floatBits[0], sizeof(floatBits[0])) != 0 :
+                 i < 5 ? param.Value.Float == param.Value.Float :
+                 i == 5 ? memcmp(&param.Value.Double, &doubleBits[1], sizeof(doubleBits[1])) != 0 :
+                 param.Value.Double == param.Value.Double)
+            ) {
+                return (__LINE__ << 16) | i;
+            }
+        }
+        if (Param_parseView("inf", 3, &values[0]) != Param_Ok || values[0].Type != Param_ValueType_Float ||
+            Param_parseView("-nan", 4, &values[0]) == Param_Ok || Param_parseView("infinity", 8, &values[0]) == Param_Ok
+        ) {
+            return __LINE__ << 16;
+        }
+    #endif
+    }
+
+    return 0;
+}
+
+Test_Result Test_9(void) {
+    char str[200];
+    char expected[40];
+    Param_Value values[10];
+    Param_Value value;
+    uint64_t seed = 0x853C49E6748FEA9BULL;
+    int i;
+
+    // digits length boundaries
+    setValue(0, Number, 0);
+    setValue(1, Number, 9);
+    setValue(2, Number, 10);
+    setValue(3, Number, -99);
+    setValue(4, Number, 100);
+    setValue(5, Number, INT64_MIN);
+    setValue(6, Number, INT64_MAX);
+    setValue(7, UNumber, UINT64_MAX);
+    setValue(8, Int8, -128);
+    setValue(9, UInt8, 255);
+    Param_toStr(str, values, 10, ",");
+    assert(Str, str, "0,9,10,-99,100,-9223372036854775808,9223372036854775807,18446744073709551615,-128,255");
+
+    setValue(0, NumberHex, 0);
+    setValue(1, NumberHex, 0xF);
+    setValue(2, NumberHex, 0xABCDEF0123456789ULL);
+    setValue(3, NumberBinary, 0);
+    setValue(4, NumberBinary, 1);
+    setValue(5, NumberBinary, 0x80);
+    setValue(6, NumberBinary, 0x155);
+    setValue(7, UInt64, 10000000000000000000ULL);
+    Param_toStr(str, values, 8, ",");
+    assert(Str, str, "0x0,0xF,0xABCDEF0123456789,0b0,0b1,0b10000000,0b101010101,10000000000000000000");
+
+    // compare with printf
+    for (i = 0; i < 100000; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        value.Type = Param_ValueType_Number;
+        value.Number = (Param_Number) (seed >> (seed & 63));
+        Param_valueToStr(str, &value);
+        sprintf(expected, "%lld", (long long) value.Number);
+        assert(Str, str, expected);
+        value.Type = Param_ValueType_NumberHex;
+        value.NumberHex = seed >> (seed & 63);
+        Param_valueToStr(str, &value);
+        sprintf(expected, "0x%llX", (unsigned long long) value.NumberHex);
+        assert(Str, str, expected);
+        value.Type = Param_ValueType_NumberBinary;
+        Param_valueToStr(str, &value);
+        Param_parse(str, &values[0]);
+        if (values[0].Type != Param_ValueType_NumberBinary || values[0].NumberBinary != value.NumberHex) {
+            PRINTF("%s\r\n", str);
+            return __LINE__ << 16;
+        }
+    }
+
+    return 0;
+}
+
+Test_Result Test_10(void) {
+    char str[200];
+    char chunk[200];
+    char part[16];
+    Param_Value values[10];
+    Param_ToStrPos pos;
+    Str_LenType len;
+    Str_LenType total;
+    Str_LenType size;
+    Str_LenType sizes[] = {1, 2, 3, 7, 13};
+    int i;
+
+    setValue(0, Number, -12345);
+    setValue(1, String, "a\"b\\c\nd");
+    setValue(2, Float, 0.5f);
+    setValue(3, NumberHex, 0xBEEF);
+    setValue(4, Boolean, 1);
+    setView(5, StringView, "view");
+    setView(6, UnknownView, "raw");
+    setValue(7, Unknown, "unknown");
+    setValue(8, NumberBinary, 5);
+    setValue(9, UInt8, 200);
+
+    len = Param_toStr(str, values, 10, ", ");
+    assert(Str, str, "-12345, \"a\\\"b\\\\c\\nd\", 0.5, 0xBEEF, True, \"view\", raw, unknown, 0b101, 200");
+    if (Param_toStrLen(values, 10, ", ") != len) {
+        return __LINE__ << 16;
+    }
+    for (i = 0; i < 10; i++) {
+        if (Param_valueToStrLen(&values[i]) != Param_valueToStr(chunk, &values[i])) {
+            return __LINE__ << 16;
+        }
+    }
+
+    // resume with small buffers, output must be same as Param_toStr
+    for (i = 0; i < (int) ARRAY_LEN(sizes); i++) {
+        memset(&pos, 0, sizeof(pos));
+        total = 0;
+        while (pos.Index < 10) {
+            memset(part, '#', sizeof(part));
+            size = Param_toStrN(part, sizes[i], values, 10, ", ", &pos);
+            if (size > sizes[i] || part[sizes[i]] != '#') {
+                return __LINE__ << 16;
+            }
+            memcpy(&chunk[total], part, size);
+            total += size;
+        }
+        chunk[total] = '\0';
+        assert(Str, chunk, str);
+    }
+
+    // null separator and empty array
+    len = Param_toStr(str, values, 3, NULL);
+    assert(Str, str, "-12345\"a\\\"b\\\\c\\nd\"0.5");
+    if (Param_toStrLen(values, 3, NULL) != len) {
+        return __LINE__ << 16;
+    }
+    len = Param_toStr(str, values, 0, ",");
+    assert(Str, str, "");
+    if (len != 0 || Param_toStrLen(values, 0, ",") != 0) {
+        return __LINE__ << 16;
+    }
+    memset(&pos, 0, sizeof(pos));
+    size = Param_toStrN(chunk, sizeof(chunk), values, 3, NULL, &pos);
+    Param_toStr(str, values, 3, NULL);
+    assert(Str, chunk, str);
+    if (pos.Index != 3 || size != Str_len(str)) {
+        return __LINE__ << 16;
+    }
+    // escapes around chunks of long strings, same length and output as Param_valueToStr
+    setValue(0, String, "0123456789012345678901234567890\"\\23456789012345678901234567890\n\"x\t");
+    len = Param_valueToStr(str, &values[0]);
+    if (Param_valueToStrLen(&values[0]) != len || len != Str_len(values[0].String) + 2 + 5) {
+        return __LINE__ << 16;
+    }
+    memset(&pos, 0, sizeof(pos));
+    total = 0;
+    while (pos.Index < 1) {
+        size = Param_toStrN(part, 5, values, 1, NULL, &pos);
+        memcpy(&chunk[total], part, size);
+        total += size;
+    }
+    chunk[total] = '\0';
+    assert(Str, chunk, str);
+
+    return 0;
+}
+
+/**
+ * @brief append params of stream to string of Args, "|" before first param of each line
+ */
+void Test_onStreamParam(Param_Stream* stream, Param* param) {
+    char* str = (char*) stream->Args;
+    str += Str_len(str);
+    *str++ = param->Index == 0 ? '|' : ',';
+    Param_valueToStr(str, &param->Value);
+}
+Test_Result Test_11(void) {
+    const char* input = "  12, \"Text Data\" ,0x1F,true, -2.5e3 ,null,  something\r\n"
+                        "on,0b11,,\"\"\n"
+                        "\n"
+                        "last, 1234";
+    const char* expected = "|12,\"Text Data\",0x1F,True,-2500.0,Null,something|On,0b11,,\"\"|last,1234";
+    char buffer[16];
+    char str[200];
+    Param_Stream stream;
+    Str_LenType inputLen = Str_len(input);
+    Str_LenType chunk;
+    Str_LenType i;
+    Str_LenType n;
+
+    // every chunk size must give same params
+    for (chunk = 1; chunk <= inputLen; chunk++) {
+        Param_initStream(&stream, buffer, sizeof(buffer), ',', '\n', Test_onStreamParam);
+        stream.Args = str;
+        str[0] = '\0';
+        for (i = 0; i < inputLen; i += n) {
+            n = inputLen - i < chunk ? inputLen - i : chunk;
+            if (Param_feed(&stream, &input[i], n) != Param_Ok) {
+                return __LINE__ << 16;
+            }
+        }
+        if (Param_flush(&stream) != Param_Ok) {
+            return __LINE__ << 16;
+        }
+        assert(Str, str, expected);
+    }
+
+    // param longer than buffer is dropped
+    Param_initStream(&stream, buffer, 4, ',', '\n', Test_onStreamParam);
+    stream.Args = str;
+    str[0] = '\0';
+    if (Param_feed(&stream, "1,12", 4) != Param_Ok ||
+        Param_feed(&stream, "345,", 4) != Param_Error ||
+        Param_feed(&stream, "3", 1) != Param_Ok ||
+        Param_flush(&stream) != Param_Ok
+    ) {
+        return __LINE__ << 16;
+    }
+    assert(Str, str, "|1,3");
+
+    // trailing separator give same params as Param_next
+    {
+        static const char* lines[] = {
+            "a, ", " , ", "a,", "a", "", "  ", "a,,", ",", "a, \r",
+        };
+        char line[16];
+        char nextStr[64];
+        Param_Cursor cursor;
+        Param param;
+        uint8_t l;
+
+        for (l = 0; l < ARRAY_LEN(lines); l++) {
+            strcpy(line, lines[l]);
+            nextStr[0] = '\0';
+            Param_initCursor(&cursor, line, Str_len(line), ',');
+            stream.Args = nextStr;
+            while (Param_next(&cursor, &param) != NULL) {
+                Test_onStreamParam(&stream, &param);
+            }
+            inputLen = Str_len(lines[l]);
+            for (chunk = 1; chunk <= inputLen || chunk == 1; chunk++) {
+                Param_initStream(&stream, buffer, sizeof(buffer), ',', '\n', Test_onStreamParam);
+                stream.Args = str;
+                str[0] = '\0';
+                for (i = 0; i < inputLen; i += n) {
+                    n = inputLen - i < chunk ? inputLen - i : chunk;
+                    Param_feed(&stream, &lines[l][i], n);
+                }
+                Param_flush(&stream);
+                assert(Str, str, nextStr);
+            }
+        }
+    }
+
+    return 0;
+}
+
+typedef struct {
+    int32_t     Id;
+    float       Value;
+    char*       Name;
+    uint8_t     Enable;
+    uint8_t     Level;
+    int8_t      Offset;
+    uint16_t    Mask;
+    double      Scale;
+    int64_t     Total;
+} Test_Command;
+
+static const Param_Field Test_CommandFields[] = {
+    PARAM_FIELD(Int32, Test_Command, Id),
+    PARAM_FIELD(Float, Test_Command, Value),
+    PARAM_FIELD(String, Test_Command, Name),
+    PARAM_FIELD(StateKey, Test_Command, Enable),
+    PARAM_FIELD(UInt8, Test_Command, Level),
+    PARAM_FIELD(Int8, Test_Command, Offset),
+    PARAM_FIELD(UInt16, Test_Command, Mask),
+    PARAM_FIELD(Double, Test_Command, Scale),
+    PARAM_FIELD(Int64, Test_Command, Total),
+};
+static const Param_Schema Test_CommandSchema = {
+    Test_CommandFields, ARRAY_LEN(Test_CommandFields),
+};
+
+Test_Result Test_12(void) {
+    char buff[100];
+    Param_Cursor cursor;
+    Test_Command cmd;
+
+    strcpy(buff, "-12, 3, \"Motor\\n1\", on, 255, -128, 65535, 0.1, -9223372036854775808");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseInto(&cursor, &Test_CommandSchema, &cmd) != Test_CommandSchema.Len) {
+        return __LINE__ << 16;
+    }
+    assert(Str, cmd.Name, "Motor\n1");
+    if (cmd.Id != -12 || cmd.Value != 3.0f || cmd.Enable != 1 || cmd.Level != 255 || cmd.Offset != -128 ||
+        cmd.Mask != 65535 || cmd.Scale != 0.1 || cmd.Total != INT64_MIN
+    ) {
+        return __LINE__ << 16;
+    }
+
+    // suffix must match
+    strcpy(buff, "7i32, 2.5f, \"A\", off, 1u8, 0i8, 0, 1e3f64, 0");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseInto(&cursor, &Test_CommandSchema, &cmd) != Test_CommandSchema.Len ||
+        cmd.Id != 7 || cmd.Value != 2.5f || cmd.Enable != 0 || cmd.Scale != 1000.0
+    ) {
+        return __LINE__ << 16;
+    }
+
+    // mismatch index
+    strcpy(buff, "1, 2, \"A\", on, 256, 0, 0, 0, 0");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseInto(&cursor, &Test_CommandSchema, &cmd) != 4) {
+        return __LINE__ << 16;
+    }
+    strcpy(buff, "1, 2, \"A\", on, 1, -129");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseInto(&cursor, &Test_CommandSchema, &cmd) != 5) {
+        return __LINE__ << 16;
+    }
+    strcpy(buff, "1.5, 2");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseInto(&cursor, &Test_CommandSchema, &cmd) != 0) {
+        return __LINE__ << 16;
+    }
+    strcpy(buff, "1, 2, Text");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseInto(&cursor, &Test_CommandSchema, &cmd) != 2) {
+        return __LINE__ << 16;
+    }
+    strcpy(buff, "1, 2, \"A\", on, 1, -1, 0, 0u8");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseInto(&cursor, &Test_CommandSchema, &cmd) != 7) {
+        return __LINE__ << 16;
+    }
+    // missing params
+    strcpy(buff, "1, 2, \"A\"");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseInto(&cursor, &Test_CommandSchema, &cmd) != 3) {
+        return __LINE__ << 16;
+    }
+
+    return 0;
+}
+
+Test_Result Test_13(void) {
+    static const char* keywords[] = {"true", "false", "high", "low", "on", "off", "null"};
+    char buff[100];
+    char str[8];
+    Param_Value values[10];
+    Param_Value value;
+    int i, j, n;
+
+    // case insensitive keywords, unknown tokens must not change
+    strcpy(buff, "TRUE,fAlSe,High,LOW,oN,OFF,NuLL,TrueLove,Nothing,Offset");
+    setValue(0, Boolean, 1);
+    setValue(1, Boolean, 0);
+    setValue(2, State, 1);
+    setValue(3, State, 0);
+    setValue(4, StateKey, 1);
+    setValue(5, StateKey, 0);
+    setValue(6, Null, "NuLL");
+    setValue(7, Unknown, "TrueLove");
+    setValue(8, Unknown, "Nothing");
+    setValue(9, Unknown, "Offset");
+    assert(Param, buff, values, 10);
+    assert(Str, buff, "TRUE");
+    setView(6, NullView, "NuLL");
+    setView(7, UnknownView, "TrueLove");
+    setView(8, UnknownView, "Nothing");
+    setView(9, UnknownView, "Offset");
+    assert(ParamView, "TRUE,fAlSe,High,LOW,oN,OFF,NuLL,TrueLove,Nothing,Offset", values, 10);
+
+    // near keywords
+    strcpy(buff, "tru,truee,o,onn,of,nul,nulls,hi,lo,lows");
+    setValue(0, Unknown, "tru");
+    setValue(1, Unknown, "truee");
+    setValue(2, Unknown, "o");
+    setValue(3, Unknown, "onn");
+    setValue(4, Unknown, "of");
+    setValue(5, Unknown, "nul");
+    setValue(6, Unknown, "nulls");
+    setValue(7, Unknown, "hi");
+    setValue(8, Unknown, "lo");
+    setValue(9, Unknown, "lows");
+    assert(Param, buff, values, 10);
+
+    // only keywords, inf and nan match, all lower case words with 2 or 3 letters and keywords with one changed letter
+    for (n = 2; n <= 3; n++) {
+        for (i = 0; i < (n == 2 ? 26 * 26 : 26 * 26 * 26); i++) {
+            int k = i;
+            for (j = 0; j < n; j++) {
+                str[j] = (char)('a' + k % 26);
+                k /= 26;
+            }
+            Param_parseView(str, n, &value);
+            str[n] = '\0';
+            k = strcmp(str, "low") == 0 || strcmp(str, "off") == 0 || strcmp(str, "on") == 0;
+        #if PARAM_TYPE_NUMBER && PARAM_TYPE_FLOAT && PARAM_CASE_MODE == PARAM_CASE_INSENSITIVE
+            k = k || strcmp(str, "inf") == 0 || strcmp(str, "nan") == 0;
+        #endif
+            if (k != (value.Type != Param_ValueType_UnknownView)) {
+                PRINTF("%s\r\n", str);
+                return __LINE__ << 16;
+            }
+        }
+    }
+    for (i = 0; i < (int) ARRAY_LEN(keywords); i++) {
+        n = Str_len(keywords[i]);
+        for (j = 0; j < n; j++) {
+            strcpy(str, keywords[i]);
+            str[j] = (char)(str[j] == 'z' ? 'a' : str[j] + 1);
+            Param_parseView(str, n, &value);
+            if (value.Type != Param_ValueType_UnknownView) {
+                PRINTF("%s\r\n", str);
+                return __LINE__ << 16;
+            }
+        }
+    }
+
+    return 0;
+}
+
+PARAM_ENUM_TABLE(Test_Mode, "auto", "manual", "off");
+PARAM_ENUM_TABLE(Test_Link, "tx", "rx", "idle", "Manual");
+
+Test_Result Test_14(void) {
+    char buff[100];
+    char str[100];
+    Param_Value values[8];
+    Param_Cursor cursor;
+    Param param;
+    int16_t mode;
+    int16_t link;
+
+    Param_clearEnums();
+    mode = Param_registerEnum(&Test_Mode);
+    link = Param_registerEnum(&Test_Link);
+    if (mode != 0 || link != 1) {
+        return __LINE__ << 16;
+    }
+
+    // registered names before built-in keywords, first table that has the name wins
+    strcpy(buff, "AUTO, idle, manual, off, rx, tx2, -1, \"tx\"");
+    setValue(0, Enum, ((Param_Enum) { 0, 0 }));
+    setValue(1, Enum, ((Param_Enum) { 1, 2 }));
+    setValue(2, Enum, ((Param_Enum) { 0, 1 }));
+    setValue(3, Enum, ((Param_Enum) { 0, 2 }));
+    setValue(4, Enum, ((Param_Enum) { 1, 1 }));
+    setValue(5, Unknown, "tx2");
+    setValue(6, Number, -1);
+    setValue(7, String, "tx");
+    assert(Param, buff, values, 8);
+    setView(5, UnknownView, "tx2");
+    setView(7, StringView, "tx");
+    assert(ParamView, "AUTO, idle, manual, off, rx, tx2, -1, \"tx\"", values, 8);
+
+    // names in toStr
+    Param_toStr(str, values, 5, ",");
+    assert(Str, str, "auto,idle,manual,off,rx");
+    if (Param_toStrLen(values, 5, ",") != Str_len(str)) {
+        return __LINE__ << 16;
+    }
+    // other keywords are not changed
+    strcpy(buff, "on, OFF, null");
+    setValue(0, StateKey, 1);
+    setValue(1, Enum, ((Param_Enum) { 0, 2 }));
+    setValue(2, Null, "null");
+    assert(Param, buff, values, 3);
+    // enum that hide a keyword is not accepted by checks of keyword types
+    strcpy(buff, "off");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_next(&cursor, &param) == NULL || !PARAM_CHECK_CATEGORY(&param, Enum) ||
+        PARAM_CHECK_CATEGORY(&param, Boolean) || PARAM_CHECK_VALUETYPE(&param, StateKey)
+    ) {
+        return __LINE__ << 16;
+    }
+
+    // not valid tables
+    {
+        static const char* const names[] = {"ok", "1st"};
+        static const Param_EnumTable table = {names, 2};
+        if (Param_registerEnum(&table) != -1) {
+            return __LINE__ << 16;
+        }
+    }
+
+    // removed enums are unknown
+    Param_clearEnums();
+    strcpy(buff, "auto");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_next(&cursor, &param) == NULL || param.Value.Type != Param_ValueType_Unknown) {
+        return __LINE__ << 16;
+    }
+
+    return 0;
+}
+
+Test_Result Test_15(void) {
+    char buff[120];
+    Param_KeyValue params[10];
+    Param_KeyValues keyValues;
+    Param_Cursor cursor;
+    Param* param;
+    uint8_t lazy;
+
+    for (lazy = 0; lazy < 2; lazy++) {
+        strcpy(buff, "rssi=-70, name = \"Node 1\", mode=on ,12, rate=2.5, a b=x, rssi=0, empty=");
+        Param_initCursor(&cursor, buff, Str_len(buff), ',');
+        Param_initKeyValues(&keyValues, params, ARRAY_LEN(params), lazy);
+        if (Param_parseKeyValues(&cursor, &keyValues) != 8) {
+            return __LINE__ << 16;
+        }
+        // values are converted only when needed
+        if (params[1].Parsed != !lazy || params[6].Parsed != !lazy) {
+            return __LINE__ << 16;
+        }
+        param = Param_find(&keyValues, "rssi");
+        if (param == NULL || param->Index != 0 || param->Value.Type != Param_ValueType_Number || param->Value.Number != -70) {
+            return __LINE__ << 16;
+        }
+        param = Param_find(&keyValues, "name");
+        if (param == NULL || param->Index != 1 || param->Value.Type != Param_ValueType_String) {
+            return __LINE__ << 16;
+        }
+        assert(Str, param->Value.String, "Node 1");
+        param = Param_find(&keyValues, "mode");
+        if (param == NULL || param->Value.Type != Param_ValueType_StateKey || param->Value.StateKey != 1) {
+            return __LINE__ << 16;
+        }
+        param = Param_find(&keyValues, "rate");
+        if (param == NULL || param->Index != 4 || param->Value.Float != 2.5f) {
+            return __LINE__ << 16;
+        }
+        param = Param_find(&keyValues, "a b");
+        if (param == NULL || param->Value.Type != Param_ValueType_Unknown) {
+            return __LINE__ << 16;
+        }
+        assert(Str, param->Value.Unknown, "x");
+        param = Param_find(&keyValues, "empty");
+        if (param == NULL || param->Index != 7) {
+            return __LINE__ << 16;
+        }
+        if (Param_find(&keyValues, "12") != NULL || Param_find(&keyValues, "rss") != NULL ||
+            Param_find(&keyValues, "rssi ") != NULL || Param_find(&keyValues, "") != NULL
+        ) {
+            return __LINE__ << 16;
+        }
+        // param without key keep its position
+        if (params[3].Key != NULL || params[3].Param.Index != 3) {
+            return __LINE__ << 16;
+        }
+        if (params[6].Parsed != !lazy) {
+            return __LINE__ << 16;
+        }
+    }
+
+    // array is full
+    strcpy(buff, "a=1, b=2, c=3");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    Param_initKeyValues(&keyValues, params, 2, 0);
+    if (Param_parseKeyValues(&cursor, &keyValues) != 2 || Param_find(&keyValues, "c") != NULL ||
+        Param_find(&keyValues, "b") == NULL || !keyValues.Truncated
+    ) {
+        return __LINE__ << 16;
+    }
+    strcpy(buff, "a=1, b=2");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    Param_initKeyValues(&keyValues, params, 2, 0);
+    if (Param_parseKeyValues(&cursor, &keyValues) != 2 || keyValues.Truncated) {
+        return __LINE__ << 16;
+    }
+    // index is at most half full
+    {
+        static Param_KeyValue many[PARAM_KEY_INDEX_SIZE];
+        Param_initKeyValues(&keyValues, many, ARRAY_LEN(many), 0);
+        if (keyValues.Size != PARAM_KEY_INDEX_SIZE / 2) {
+            return __LINE__ << 16;
+        }
+    }
+
+    return 0;
+}
+
+#if __PARAM_BULK
+static char Test_bulkBuff[200000];
+static char Test_bulkCopy[200000];
+#endif
+Test_Result Test_16(void) {
+#if __PARAM_BULK
+    static const char* lines[] = {
+        "0x1F, -25, 2.5, on, \"Text\", null, Raw",
+        "",
+        "12",
+        "  true ,False,  , high",
+        "\"a, b\", 0b1010, 3.25e-2, LOW, \"\", -0x10, off, empty, Unknown Value, 100000",
+    };
+    Param_Records records;
+    Param_Cursor cursor;
+    Param param;
+    char* pStr;
+    char* pLine;
+    char* pEnd;
+    size_t len;
+    size_t i;
+    size_t record;
+    Param_LenType index;
+    uint8_t threads;
+
+    for (threads = 1; threads <= 4; threads += 3) {
+        // lines with different lengths that cross chunk boundaries
+        len = 0;
+        i = 0;
+        while (len + 200 < sizeof(Test_bulkBuff)) {
+            len += (size_t) sprintf(&Test_bulkBuff[len], "%s\n", lines[i % ARRAY_LEN(lines)]);
+            i += 1 + (i % 7 == 3);
+        }
+        len += (size_t) sprintf(&Test_bulkBuff[len], "%s", "last, 1");
+        memcpy(Test_bulkCopy, Test_bulkBuff, len + 1);
+        if (Param_parseBulk(Test_bulkBuff, len, '\n', ',', threads, &records) != Param_Ok) {
+            return __LINE__ << 16;
+        }
+        // compare with serial parser
+        pStr = Test_bulkCopy;
+        record = 0;
+        while (pStr != NULL) {
+            pLine = pStr;
+            pEnd = strchr(pStr, '\n');
+            if (pEnd != NULL) {
+                *pEnd = '\0';
+                pStr = pEnd + 1;
+            }
+            else {
+                pStr = NULL;
+            }
+            if (record >= records.Len || records.Records[record].Number != record) {
+                return __LINE__ << 16;
+            }
+            Param_initCursor(&cursor, pLine, Str_len(pLine), ',');
+            index = 0;
+            while (Param_next(&cursor, &param) != NULL) {
+                if (index >= records.Records[record].Len ||
+                    records.Records[record].Params[index].Index != param.Index ||
+                    !Param_compareValue(&records.Records[record].Params[index].Value, &param.Value)
+                ) {
+                    return __LINE__ << 16;
+                }
+                index++;
+            }
+            if (index != records.Records[record].Len) {
+                return __LINE__ << 16;
+            }
+            record++;
+        }
+        if (record != records.Len || records.Records[1].Len != 0 || records.Records[2].Len != 1) {
+            return __LINE__ << 16;
+        }
+        Param_freeRecords(&records);
+    }
+    // 40 KB and 66 KB records longer than cursor length, trailing separator has no empty param same as short records
+    // exact size buffer, so reads after null terminator are caught by sanitizers
+    pStr = (char*) malloc(40000 + 1 + 66000 + 2 + 1);
+    if (pStr == NULL) {
+        return __LINE__ << 16;
+    }
+    for (len = 0; len < 40000; len += 2) {
+        memcpy(&pStr[len], "1,", 2);
+    }
+    pStr[len++] = '\n';
+    for (i = 0; i < 22000; i++, len += 3) {
+        memcpy(&pStr[len], "22,", 3);
+    }
+    memcpy(&pStr[len], "\n3", 3);
+    len += 2;
+    if (Param_parseBulk(pStr, len, '\n', ',', 2, &records) != Param_Ok ||
+        records.Len != 3 || records.ParamsLen != 42001 ||
+        records.Records[0].Len != 20000 || records.Records[0].Params[19999].Value.Number != 1 ||
+        records.Records[1].Len != 22000 || records.Records[1].Params[21999].Value.Number != 22 ||
+        records.Records[2].Len != 1 || records.Records[2].Params[0].Value.Number != 3
+    ) {
+        free(pStr);
+        return __LINE__ << 16;
+    }
+    Param_freeRecords(&records);
+    free(pStr);
+    // record with more params than Param_LenType
+    for (len = 0; len < 80000; len += 2) {
+        memcpy(&Test_bulkBuff[len], "1,", 2);
+    }
+    Test_bulkBuff[len - 1] = '\0';
+    if (Param_parseBulk(Test_bulkBuff, len - 1, '\n', ',', 4, &records) != Param_Error ||
+        records.Records != NULL || records.Params != NULL
+    ) {
+        return __LINE__ << 16;
+    }
+#endif
+    return 0;
+}
+
+Test_Result Test_17(void) {
+#if __PARAM_FILE
+    static const char* path = "Param-Test-File.txt";
+    Param_File file;
+    Param_Cursor cursor;
+    Param param;
+    FILE* fp;
+    int index;
+    // file without record separator at end
+    fp = fopen(path, "wb");
+    if (fp == NULL) {
+        return __LINE__ << 16;
+    }
+    fputs("12, on ,\"a b\"\n\n  0x1F\r\nlast, 2.5", fp);
+    fclose(fp);
+
+    if (Param_openFile(&file, path, '\n', ',') != Param_Ok) {
+        remove(path);
+        return __LINE__ << 16;
+    }
+    if (Param_nextRecord(&file, &cursor) == NULL ||
+        Param_nextView(&cursor, &param) == NULL || param.Value.Type != Param_ValueType_Number || param.Value.Number != 12 ||
+        Param_nextView(&cursor, &param) == NULL || param.Value.Type != Param_ValueType_StateKey || param.Value.StateKey != 1 ||
+        Param_nextView(&cursor, &param) == NULL || param.Value.Type != Param_ValueType_StringView || param.Value.Len != 3 ||
+        Param_nextView(&cursor, &param) != NULL
+    ) {
+        Param_closeFile(&file);
+        remove(path);
+        return __LINE__ << 16;
+    }
+    // empty record
+    if (Param_nextRecord(&file, &cursor) == NULL || Param_nextView(&cursor, &param) != NULL || file.Record != 2) {
+        Param_closeFile(&file);
+        remove(path);
+        return __LINE__ << 16;
+    }
+    if (Param_nextRecord(&file, &cursor) == NULL ||
+        Param_nextView(&cursor, &param) == NULL || param.Value.Type != Param_ValueType_NumberHex || param.Value.NumberHex != 0x1F ||
+        Param_nextView(&cursor, &param) != NULL
+    ) {
+        Param_closeFile(&file);
+        remove(path);
+        return __LINE__ << 16;
+    }
+    if (Param_nextRecord(&file, &cursor) == NULL ||
+        Param_nextView(&cursor, &param) == NULL || param.Value.Type != Param_ValueType_UnknownView ||
+        Param_nextView(&cursor, &param) == NULL || param.Value.Type != Param_ValueType_Float || param.Value.Float != 2.5f ||
+        Param_nextRecord(&file, &cursor) != NULL || file.Record != 4
+    ) {
+        Param_closeFile(&file);
+        remove(path);
+        return __LINE__ << 16;
+    }
+    // read again
+    Param_rewindFile(&file);
+    if (Param_nextRecord(&file, &cursor) == NULL || cursor.Len != 13) {
+        Param_closeFile(&file);
+        remove(path);
+        return __LINE__ << 16;
+    }
+    Param_closeFile(&file);
+    // record longer than cursor length
+    fp = fopen(path, "wb");
+    if (fp == NULL) {
+        return __LINE__ << 16;
+    }
+    for (index = 0; index < 20000; index++) {
+        fputs("1,", fp);
+    }
+    fputs("\n12", fp);
+    fclose(fp);
+    if (Param_openFile(&file, path, '\n', ',') != Param_Ok ||
+        Param_nextRecord(&file, &cursor) == NULL || !file.Truncated || cursor.Len != 0x7FFF || cursor.Ptr[cursor.Len] != ','
+    ) {
+        Param_closeFile(&file);
+        remove(path);
+        return __LINE__ << 16;
+    }
+    index = 0;
+    while (Param_nextView(&cursor, &param) != NULL) {
+        index += param.Value.Type == Param_ValueType_Number && param.Value.Number == 1;
+    }
+    if (index != 0x4000 ||
+        Param_nextRecord(&file, &cursor) == NULL || file.Truncated || file.Record != 2 ||
+        Param_nextView(&cursor, &param) == NULL || param.Value.Number != 12
+    ) {
+        Param_closeFile(&file);
+        remove(path);
+        return __LINE__ << 16;
+    }
+    Param_closeFile(&file);
+    // empty file
+    fp = fopen(path, "wb");
+    if (fp != NULL) {
+        fclose(fp);
+    }
+    if (Param_openFile(&file, path, '\n', ',') != Param_Ok || Param_nextRecord(&file, &cursor) != NULL) {
+        remove(path);
+        return __LINE__ << 16;
+    }
+    Param_closeFile(&file);
+    remove(path);
+    if (Param_openFile(&file, path, '\n', ',') != Param_Error) {
+        return __LINE__ << 16;
+    }
+#endif
+    return 0;
+}
+
+Test_Result Test_18(void) {
+    char buff[160];
+#if PARAM_TYPE_64BIT
+    int64_t ids[5];
+    double values[5];
+#else
+    int32_t ids[5];
+    float values[5];
+#endif
+    char* names[5];
+    uint8_t enables[5];
+    uint8_t valid[4][1];
+    Param_Column column[] = {
+    #if PARAM_TYPE_64BIT
+        PARAM_COLUMN(Int64, ids, valid[0]),
+        PARAM_COLUMN(Double, values, valid[1]),
+    #else
+        PARAM_COLUMN(Int32, ids, valid[0]),
+        PARAM_COLUMN(Float, values, valid[1]),
+    #endif
+        PARAM_COLUMN(String, names, valid[2]),
+        PARAM_COLUMN(StateKey, enables, valid[3]),
+    };
+    Param_Columns columns;
+    Param_TableCursor table;
+    Param_Cursor cursor;
+    Param param;
+
+    strcpy(buff, "1, 2.5, \"a\", on\n-2,x, \"b b\",off\n\n3 , 4.25, c, on, extra\r\n4, 1e3");
+    Param_initTableCursor(&table, buff, Str_len(buff), '\n', ',');
+    Param_initColumns(&columns, column, ARRAY_LEN(column), 3);
+    memset(valid, 0, sizeof(valid));
+    // columns are full after 3 rows
+    if (Param_parseColumns(&table, &columns) != 3 || table.Record != 3) {
+        return __LINE__ << 16;
+    }
+    if (ids[0] != 1 || ids[1] != -2 || values[0] != 2.5 || values[1] != 0 ||
+        valid[0][0] != 0x03 || valid[1][0] != 0x01 || valid[2][0] != 0x03 || valid[3][0] != 0x03 ||
+        enables[0] != 1 || enables[1] != 0
+    ) {
+        return __LINE__ << 16;
+    }
+    assert(Str, names[0], "a");
+    assert(Str, names[1], "b b");
+    // continue with more space
+    columns.Size = 5;
+    if (Param_parseColumns(&table, &columns) != 2 || columns.Rows != 5 || Param_parseColumns(&table, &columns) != 0) {
+        return __LINE__ << 16;
+    }
+    if (ids[3] != 3 || values[3] != 4.25 || names[3] != NULL || enables[3] != 1 || ids[4] != 4 || values[4] != 1000 ||
+        valid[0][0] != 0x1B || valid[1][0] != 0x19 || valid[2][0] != 0x03 || valid[3][0] != 0x0B
+    ) {
+        return __LINE__ << 16;
+    }
+    // row-wise access
+    strcpy(buff, "a,b\n\n1");
+    Param_initTableCursor(&table, buff, Str_len(buff), '\n', ',');
+    if (Param_nextRow(&table, &cursor) == NULL || Param_next(&cursor, &param) == NULL || Param_next(&cursor, &param) == NULL ||
+        Param_next(&cursor, &param) != NULL ||
+        Param_nextRow(&table, &cursor) == NULL || Param_next(&cursor, &param) != NULL ||
+        Param_nextRow(&table, &cursor) == NULL || Param_next(&cursor, &param) == NULL || param.Value.Number != 1 ||
+        Param_nextRow(&table, &cursor) != NULL || table.Record != 3
+    ) {
+        return __LINE__ << 16;
+    }
+    // records longer than cursor length, exact size buffer so reads after null terminator are caught by sanitizers
+    {
+        static const uint32_t lens[] = { 40000, 60000, 100000, 130000 };
+        char* text = (char*) malloc(40000 + 60000 + 100000 + 130000 + ARRAY_LEN(lens) + 2);
+        size_t len = 0;
+        uint32_t count;
+        uint32_t i, j;
+
+        if (text == NULL) {
+            return __LINE__ << 16;
+        }
+        for (i = 0; i < ARRAY_LEN(lens); i++) {
+            for (j = 0; j < lens[i]; j += 2, len += 2) {
+                memcpy(&text[len], "5,", 2);
+            }
+            text[len++] = '\n';
+        }
+        memcpy(&text[len], "9", 2);
+        Param_initTableCursor(&table, text, len + 1, '\n', ',');
+        for (i = 0; i < ARRAY_LEN(lens); i++) {
+            count = 0;
+            if (Param_nextRow(&table, &cursor) == NULL) {
+                free(text);
+                return (__LINE__ << 16) | i;
+            }
+            while (Param_next(&cursor, &param) != NULL) {
+                count += param.Value.Type == Param_ValueType_Number && param.Value.Number == 5;
+                if (count * 2 > lens[i]) {
+                    break;
+                }
+            }
+            if (count != lens[i] / 2) {
+                free(text);
+                return (__LINE__ << 16) | i;
+            }
+        }
+        i = Param_nextRow(&table, &cursor) == NULL || Param_next(&cursor, &param) == NULL || param.Value.Number != 9 ||
+            Param_nextRow(&table, &cursor) != NULL || table.Record != 5;
+        free(text);
+        if (i) {
+            return __LINE__ << 16;
+        }
+    }
+
+    return 0;
+}
+
+Test_Result Test_19(void) {
+#if PARAM_STATS
+    static Param_Stats stats;
+    char buff[80];
+    Param_Cursor cursor;
+    Param params[10];
+#if PARAM_STATS_CYCLES
+    uint32_t calls;
+    uint8_t i;
+#endif
+
+    Param_statsReset();
+    strcpy(buff, "12, 2.5f64, 0x1F, \"Text\", on, null, name, 7u8, -3");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseAll(&cursor, params, ARRAY_LEN(params)) != 9) {
+        return __LINE__ << 16;
+    }
+    Param_statsSnapshot(&stats);
+    if (stats.Tokens[Param_ValueType_Number] != 2 || stats.Tokens[Param_ValueType_Double] != 1 ||
+        stats.Tokens[Param_ValueType_NumberHex] != 1 || stats.Tokens[Param_ValueType_String] != 1 ||
+        stats.Tokens[Param_ValueType_StateKey] != 1 || stats.Tokens[Param_ValueType_Null] != 1 ||
+        stats.Tokens[Param_ValueType_Unknown] != 1 || stats.Tokens[Param_ValueType_UInt8] != 1 ||
+        stats.Unknown != 1 || stats.Suffix != 2 || stats.Bytes != Str_len("12, 2.5f64, 0x1F, \"Text\", on, null, name, 7u8, -3")
+    ) {
+        return __LINE__ << 16;
+    }
+    // view mode count too
+    Param_initCursorView(&cursor, "1, x", 4, ',');
+    while (Param_nextView(&cursor, &params[0]) != NULL) {}
+    Param_statsSnapshot(&stats);
+    if (stats.Tokens[Param_ValueType_Number] != 3 || stats.Tokens[Param_ValueType_UnknownView] != 1 ||
+        stats.Unknown != 2 || stats.Bytes != Str_len("12, 2.5f64, 0x1F, \"Text\", on, null, name, 7u8, -3") + 4
+    ) {
+        return __LINE__ << 16;
+    }
+#if PARAM_STATS_CYCLES
+    calls = 0;
+    for (i = 0; i < PARAM_STATS_BUCKETS; i++) {
+        calls += stats.Cycles[Param_StatsFn_Number][i];
+    }
+    if (calls != 6) {
+        return __LINE__ << 16;
+    }
+#endif
+    Param_statsReset();
+    Param_statsSnapshot(&stats);
+    if (stats.Tokens[Param_ValueType_Number] != 0 || stats.Bytes != 0 || stats.Dropped != 0) {
+        return __LINE__ << 16;
+    }
+#if __PARAM_BULK
+    // each worker has own block, no counter is lost
+    {
+        Param_Records records;
+        size_t len;
+
+        for (len = 0; len + 4 < sizeof(Test_bulkBuff); len += 4) {
+            memcpy(&Test_bulkBuff[len], "1,2\n", 4);
+        }
+        Test_bulkBuff[len] = '\0';
+        if (Param_parseBulk(Test_bulkBuff, len, '\n', ',', 4, &records) != Param_Ok) {
+            return __LINE__ << 16;
+        }
+        Param_freeRecords(&records);
+        Param_statsSnapshot(&stats);
+        if (stats.Tokens[Param_ValueType_Number] != len / 2 || stats.Dropped != 0) {
+            return __LINE__ << 16;
+        }
+    }
+#endif
+#endif
+    return 0;
+}
+
+Test_Result Test_20(void) {
+#if PARAM_BINARY
+    static const char view[] = "view, rest";
+    uint8_t buf[128];
+    Param_Value values[16];
+    Param_Value decoded[16];
+    Str_LenType len;
+    Param_LenType count;
+    Param_LenType i;
+
+    setValue(0, Number, -300);
+    setValue(1, UNumber, 300);
+    setValue(2, NumberHex, 0xABCD);
+    setValue(3, Int8, -128);
+    setValue(4, UInt16, 65535);
+    setValue(5, Int32, INT32_MIN);
+    setValue(6, Boolean, 1);
+    setValue(7, StateKey, 0);
+    setValue(8, Float, -2.5f);
+    setValue(9, String, "Text");
+    setValue(10, Null, "null");
+    values[11].Type = Param_ValueType_StringView;
+    values[11].StringView = (char*) view;
+    values[11].Len = 4;
+#if PARAM_TYPE_64BIT
+    setValue(12, Double, 1e300);
+    setValue(13, Int64, INT64_MIN);
+    setValue(14, UInt64, UINT64_MAX);
+    count = 15;
+#else
+    count = 12;
+#endif
+    len = Param_toBinaryLen(values, count);
+    if (len <= 0 || Param_toBinary(buf, sizeof(buf), values, count) != len) {
+        return __LINE__ << 16;
+    }
+    // zigzag varint of -300 use two bytes
+    if (buf[0] != Param_ValueType_Number || buf[3] != Param_ValueType_UNumber) {
+        return __LINE__ << 16;
+    }
+    if (Param_fromBinary(buf, len, decoded, ARRAY_LEN(decoded)) != count) {
+        return __LINE__ << 16;
+    }
+    for (i = 0; i < count; i++) {
+        if (decoded[i].Type != values[i].Type || (i != 11 && !Param_compareValue(&decoded[i], &values[i]))) {
+            return (__LINE__ << 16) | i;
+        }
+    }
+    // strings point into buffer without copy
+    if (decoded[9].String < (char*) buf || decoded[9].String >= (char*) buf + len || decoded[9].Len != 4 ||
+        decoded[11].Len != 4 || strncmp(decoded[11].StringView, "view", 4) != 0 || decoded[11].StringView[4] != '\0'
+    ) {
+        return __LINE__ << 16;
+    }
+    assert(Str, decoded[9].String, "Text");
+    // limit number of values
+    if (Param_fromBinary(buf, len, decoded, 3) != 3 || decoded[2].NumberHex != 0xABCD) {
+        return __LINE__ << 16;
+    }
+    // small buffer
+    if (Param_toBinary(buf, len - 1, values, count) != -1 || Param_toBinary(buf, 0, values, 1) != -1) {
+        return __LINE__ << 16;
+    }
+    // truncated and malformed inputs
+    Param_toBinary(buf, sizeof(buf), values, count);
+    for (i = 1; i < len; i++) {
+        if (Param_fromBinary(buf, i, decoded, ARRAY_LEN(decoded)) > count) {
+            return (__LINE__ << 16) | i;
+        }
+    }
+    buf[0] = 0xFF;
+    if (Param_fromBinary(buf, len, decoded, ARRAY_LEN(decoded)) != -1) {
+        return __LINE__ << 16;
+    }
+    // Int8 out of range
+    buf[0] = Param_ValueType_Int8;
+    buf[1] = 0x80;
+    buf[2] = 0x02;
+    if (Param_fromBinary(buf, 3, decoded, 1) != -1 || Param_fromBinary(buf, 2, decoded, 1) != -1) {
+        return __LINE__ << 16;
+    }
+    // string without null terminator
+    buf[0] = Param_ValueType_String;
+    buf[1] = 2;
+    buf[2] = 'a';
+    buf[3] = 'b';
+    buf[4] = 'c';
+    if (Param_fromBinary(buf, 5, decoded, 1) != -1 || Param_fromBinary(buf, 4, decoded, 1) != -1) {
+        return __LINE__ << 16;
+    }
+    buf[4] = '\0';
+    if (Param_fromBinary(buf, 5, decoded, 1) != 1 || decoded[0].Len != 2) {
+        return __LINE__ << 16;
+    }
+    assert(Str, decoded[0].String, "ab");
+    // empty input
+    if (Param_fromBinary(buf, 0, decoded, 1) != 0) {
+        return __LINE__ << 16;
+    }
+    // Boolean, State and StateKey are only 0 or 1
+    buf[0] = Param_ValueType_State;
+    buf[1] = 2;
+    if (Param_fromBinary(buf, 2, decoded, 1) != -1) {
+        return __LINE__ << 16;
+    }
+    buf[1] = 1;
+    if (Param_fromBinary(buf, 2, decoded, 1) != 1 || decoded[0].State != 1) {
+        return __LINE__ << 16;
+    }
+    // length more than Str_LenType, 2000 strings of 20 characters need 46000 bytes
+    {
+        static Param_Value many[2000];
+        for (i = 0; i < (Param_LenType) ARRAY_LEN(many); i++) {
+            setValue(0, String, "01234567890123456789");
+            many[i] = values[0];
+        }
+        if (Param_toBinaryLen(many, 1000) != 23000 || Param_toBinaryLen(many, 2000) != -1 ||
+            Param_toBinary(buf, sizeof(buf), many, 2000) != -1
+        ) {
+            return __LINE__ << 16;
+        }
+    }
+#endif
+    return 0;
+}
+
+Test_Result Test_21(void) {
+    static const char line[] = " 12 , \"a b\",, 0x1F,on ,name,2.5 ";
+    Str_LenType offsets[8];
+    Param_Index index;
+    Param_Value value;
+    Param_Cursor cursor;
+    Param param;
+    Param_LenType i;
+
+    if (Param_index(&index, line, Str_len(line), ',', offsets, ARRAY_LEN(offsets)) != 7) {
+        return __LINE__ << 16;
+    }
+    // same values as Param_nextView
+    Param_initCursorView(&cursor, line, Str_len(line), ',');
+    for (i = 0; i < index.Len; i++) {
+        if (Param_nextView(&cursor, &param) == NULL || Param_get(&index, i, &value) != Param_Ok ||
+            !Param_compareValue(&value, &param.Value)
+        ) {
+            return (__LINE__ << 16) | i;
+        }
+    }
+    if (Param_nextView(&cursor, &param) != NULL) {
+        return __LINE__ << 16;
+    }
+    // random access
+    if (Param_get(&index, 6, &value) != Param_Ok || value.Type != Param_ValueType_Float || value.Float != 2.5f ||
+        Param_get(&index, 1, &value) != Param_Ok || value.Type != Param_ValueType_StringView || value.Len != 3 ||
+        Param_get(&index, 2, &value) != Param_Ok || value.Type != Param_ValueType_UnknownView || value.Len != 0 ||
+        Param_get(&index, 7, &value) != Param_Error || Param_get(&index, -1, &value) != Param_Error
+    ) {
+        return __LINE__ << 16;
+    }
+    // index only first params
+    if (Param_index(&index, line, Str_len(line), ',', offsets, 2) != 2 ||
+        Param_get(&index, 1, &value) != Param_Ok || value.Type != Param_ValueType_StringView || value.Len != 3 ||
+        Param_get(&index, 2, &value) != Param_Error
+    ) {
+        return __LINE__ << 16;
+    }
+    // trailing separator and empty line
+    if (Param_index(&index, "1,", 2, ',', offsets, ARRAY_LEN(offsets)) != 1 ||
+        Param_get(&index, 0, &value) != Param_Ok || value.Number != 1 ||
+        Param_index(&index, "", 0, ',', offsets, ARRAY_LEN(offsets)) != 0
+    ) {
+        return __LINE__ << 16;
+    }
+
+    return 0;
+}
+
+Test_Result Test_22(void) {
+    char buff[80];
+    Param_Cursor cursor;
+    Param_Lazy params[8];
+    Param_Number num;
+    float flt;
+    Param_LenType len = 0;
+
+    strcpy(buff, "12, 0x1F, 2.5, \"Text\", on, name, -3u8, 0b101");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    while (len < (Param_LenType) ARRAY_LEN(params) && Param_nextLazy(&cursor, &params[len]) != NULL) {
+        len++;
+    }
+    if (len != 8) {
+        return __LINE__ << 16;
+    }
+    // guess of first character, values are not converted yet
+    if (params[0].Param.Value.Type != Param_ValueType_Number || params[1].Param.Value.Type != Param_ValueType_NumberHex ||
+        params[2].Param.Value.Type != Param_ValueType_Number || params[3].Param.Value.Type != Param_ValueType_String ||
+        params[4].Param.Value.Type != Param_ValueType_Unknown || params[7].Param.Value.Type != Param_ValueType_NumberBinary ||
+        params[0].Parsed || params[7].Param.Index != 7
+    ) {
+        return __LINE__ << 16;
+    }
+    assert(Str, params[2].Str, "2.5");
+    assert(Str, params[3].Str, "\"Text\"");
+    if (params[5].Len != 4) {
+        return __LINE__ << 16;
+    }
+    // converted on first access
+    if (Param_getNumber(&params[0], &num) != Param_Ok || num != 12 || !params[0].Parsed ||
+        Param_getNumber(&params[1], &num) != Param_Ok || num != 0x1F ||
+        Param_getNumber(&params[2], &num) != Param_Error || params[2].Param.Value.Type != Param_ValueType_Float ||
+        Param_getFloat(&params[2], &flt) != Param_Ok || flt != 2.5f ||
+        Param_getFloat(&params[0], &flt) != Param_Ok || flt != 12.0f ||
+        Param_getNumber(&params[3], &num) != Param_Error || Param_getFloat(&params[4], &flt) != Param_Error ||
+        Param_getValue(&params[4])->Type != Param_ValueType_StateKey ||
+        Param_getValue(&params[5])->Type != Param_ValueType_Unknown ||
+        Param_getNumber(&params[7], &num) != Param_Ok || num != 5
+    ) {
+        return __LINE__ << 16;
+    }
+    assert(Str, Param_getValue(&params[3])->String, "Text");
+    // memoized value
+    params[0].Param.Value.Number = 7;
+    if (Param_getNumber(&params[0], &num) != Param_Ok || num != 7) {
+        return __LINE__ << 16;
+    }
+#if PARAM_TYPE_64BIT
+    {
+        double dbl;
+        if (Param_getDouble(&params[2], &dbl) != Param_Ok || dbl != 2.5) {
+            return __LINE__ << 16;
+        }
+    }
+#endif
+
+    return 0;
+}
+
+Test_Result Test_23(void) {
+#if PARAM_TAPE
+#if PARAM_TYPE_64BIT
+    static const char text[] = "12, -7, \"a\\\"b\", on, 2.5, null\n\n0xFFFFFFFFFFFFFFFF, -9223372036854775808i64, 1.5f64, name, low, 0b11";
+#else
+    static const char text[] = "12, -7, \"a\\\"b\", on, 2.5, null\n\n0xFFFFFFFF, -2147483648i32, 1.5, name, low, 0b11";
+#endif
+    char buff[sizeof(text)];
+    char copy[sizeof(text)];
+    uint64_t words[32];
+    Param params[8];
+    Param_Tape tape;
+    Param_TapeCursor reader;
+    Param_TableCursor table;
+    Param_Cursor cursor;
+    Param_Cursor expected;
+    Param param;
+    Param_LenType len;
+    Param_LenType i;
+    Param_Result res;
+    char* big;
+
+    strcpy(buff, text);
+    strcpy(copy, text);
+    Param_initTape(&tape, words, ARRAY_LEN(words), buff);
+    Param_initTableCursor(&table, buff, Str_len(buff), '\n', ',');
+    while (Param_nextRow(&table, &cursor) != NULL) {
+        if (Param_parseTape(&cursor, &tape) != Param_Ok) {
+            return __LINE__ << 16;
+        }
+    }
+    if (tape.Records != 3) {
+        return __LINE__ << 16;
+    }
+    // same values as Param_parseAll
+    Param_initTapeCursor(&reader, &tape);
+    Param_initTableCursor(&table, copy, Str_len(copy), '\n', ',');
+    while (Param_nextRow(&table, &expected) != NULL) {
+        len = Param_parseAll(&expected, params, ARRAY_LEN(params));
+        if (Param_nextTapeRecord(&reader) != len) {
+            return __LINE__ << 16;
+        }
+        for (i = 0; i < len; i++) {
+            if (Param_nextTape(&reader, &param) == NULL || param.Index != params[i].Index ||
+                param.Value.Type != params[i].Value.Type || !Param_compareValue(&param.Value, &params[i].Value)
+            ) {
+                return (__LINE__ << 16) | i;
+            }
+        }
+        if (Param_nextTape(&reader, &param) != NULL) {
+            return __LINE__ << 16;
+        }
+    }
+    if (Param_nextTapeRecord(&reader) != -1) {
+        return __LINE__ << 16;
+    }
+    // strings point into source buffer and skip records without decode
+    Param_initTapeCursor(&reader, &tape);
+    Param_nextTapeRecord(&reader);
+    Param_nextTape(&reader, &param);
+    Param_nextTape(&reader, &param);
+    if (Param_nextTape(&reader, &param) == NULL || param.Value.Type != Param_ValueType_String ||
+        param.Value.String < buff || param.Value.String >= buff + sizeof(buff) || param.Value.Len != 3 ||
+        Param_nextTapeRecord(&reader) != 0 || Param_nextTapeRecord(&reader) != 6 ||
+        Param_nextTape(&reader, &param) == NULL || param.Index != 0
+    ) {
+        return __LINE__ << 16;
+    }
+    // tape full, rest of line continue on next tape
+    strcpy(buff, "1, 2, 3, 4, 5");
+    Param_initTape(&tape, words, 6, buff);
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseTape(&cursor, &tape) != Param_Error || tape.Len != 5 || Param_parseTape(&cursor, &tape) != Param_Error) {
+        return __LINE__ << 16;
+    }
+    Param_clearTape(&tape);
+    if (Param_parseTape(&cursor, &tape) != Param_Ok || tape.Records != 1) {
+        return __LINE__ << 16;
+    }
+    Param_initTapeCursor(&reader, &tape);
+    if (Param_nextTapeRecord(&reader) != 1 || Param_nextTape(&reader, &param) == NULL ||
+        param.Index != 4 || param.Value.Number != 5 || Param_nextTape(&reader, &param) != NULL
+    ) {
+        return __LINE__ << 16;
+    }
+    // string longer than length field, record is not added
+    big = (char*) malloc(0x1000002);
+    if (big == NULL) {
+        return __LINE__ << 16;
+    }
+    memset(big, 'a', 0x1000001);
+    big[0x1000001] = '\0';
+    Param_initTape(&tape, words, ARRAY_LEN(words), big);
+    Param_initCursor(&cursor, big, 0, ',');
+    res = Param_parseTape(&cursor, &tape);
+    free(big);
+    if (res != Param_Error || tape.Len != 0 || tape.Records != 0) {
+        return __LINE__ << 16;
+    }
+#endif
+    return 0;
+}
+
+Test_Result Test_24(void) {
+    char buff[80];
+    Param_Value values[4];
+    Param_Cursor cursor;
+    Param params[10];
+    Param_LenType len;
+    Param_LenType i;
+
+    // equal values have same hash
+    setValue(0, Float, 0.0f);
+    setValue(1, Float, -0.0f);
+    setValue(2, Number, 0);
+    setValue(3, UNumber, 0);
+    if (!Param_compareValue(&values[0], &values[1]) || Param_hashValue(&values[0]) != Param_hashValue(&values[1]) ||
+        Param_hashValue(&values[2]) == Param_hashValue(&values[3])
+    ) {
+        return __LINE__ << 16;
+    }
+    strcpy(buff, "\"Text\"");
+    setValue(0, String, buff + 1);
+    buff[5] = '\0';
+    setView(1, StringView, "Text");
+    setValue(2, Null, "null");
+    setValue(3, Null, "NULL");
+    if (Param_hashValue(&values[0]) != Param_hashValue(&values[0]) ||
+        Param_hashValue(&values[0]) == Param_hashValue(&values[1]) ||
+        Param_compareValue(&values[2], &values[3]) != (Param_hashValue(&values[2]) == Param_hashValue(&values[3]))
+    ) {
+        return __LINE__ << 16;
+    }
+#if PARAM_VALUE_SET
+    {
+        static const char* const lines[] = { "1, \"a\", on, 2.5, 1, x", "\"a\", 1, off, \"b\", 2.50" };
+        Param_ValueEntry entries[16];
+        Param_ValueData data[8];
+        Param_ValueSet set;
+        Param_ValueMap map;
+        Param_ValueEntry* entry;
+        Param_ValueData* count;
+        char arena[8];
+
+        Param_initValueSet(&set, entries, 13, arena, sizeof(arena));
+        if (set.Size != 8) {
+            return __LINE__ << 16;
+        }
+        Param_initValueSet(&set, entries, ARRAY_LEN(entries), arena, sizeof(arena));
+        // same buffer for all lines, strings copy to arena
+        for (i = 0; i < (Param_LenType) ARRAY_LEN(lines); i++) {
+            strcpy(buff, lines[i]);
+            Param_initCursor(&cursor, buff, Str_len(buff), ',');
+            len = Param_parseAll(&cursor, params, ARRAY_LEN(params));
+            while (len-- > 0) {
+                if (Param_addValue(&set, &params[len].Value) == NULL) {
+                    return (__LINE__ << 16) | i;
+                }
+            }
+        }
+        memset(buff, 0, sizeof(buff));
+        // 1, a, on, 2.5, x, off, b
+        setValue(0, Number, 1);
+        setValue(1, Float, 2.5f);
+        if (set.Len != 7 || (entry = Param_findValue(&set, &values[0])) == NULL || entry->Count != 3 ||
+            (entry = Param_findValue(&set, &values[1])) == NULL || entry->Count != 2
+        ) {
+            return __LINE__ << 16;
+        }
+        setValue(0, String, "a");
+        if ((entry = Param_findValue(&set, &values[0])) == NULL || entry->Count != 2 ||
+            entry->Value.String < arena || entry->Value.String >= arena + sizeof(arena)
+        ) {
+            return __LINE__ << 16;
+        }
+        assert(Str, entry->Value.String, "a");
+        setValue(0, Number, 2);
+        if (Param_findValue(&set, &values[0]) != NULL) {
+            return __LINE__ << 16;
+        }
+        // set is full after 12 values
+        for (i = 0; i < 5; i++) {
+            setValue(0, Number, 100 + i);
+            if (Param_addValue(&set, &values[0]) == NULL) {
+                return (__LINE__ << 16) | i;
+            }
+        }
+        setValue(0, Number, 2);
+        if (set.Len != 12 || Param_addValue(&set, &values[0]) != NULL || Param_addValue(&set, &values[1]) == NULL) {
+            return __LINE__ << 16;
+        }
+        // arena is full
+        Param_clearValueSet(&set);
+        setValue(0, String, "long text");
+        if (Param_addValue(&set, &values[0]) != NULL || set.Len != 0) {
+            return __LINE__ << 16;
+        }
+        for (i = 0; i < (Param_LenType) ARRAY_LEN(entries); i++) {
+            if (entries[i].Count != 0 || entries[i].Hash != 0 || entries[i].Value.Type != (Param_ValueType) 0) {
+                return (__LINE__ << 16) | i;
+            }
+        }
+        // view keep its type, copy is null terminated
+        strcpy(buff, "abc");
+        values[0].Type = Param_ValueType_StringView;
+        values[0].StringView = buff;
+        values[0].Len = 2;
+        if ((entry = Param_addValue(&set, &values[0])) == NULL || entry->Value.Type != Param_ValueType_StringView ||
+            entry->Value.Len != 2 || entry->Value.StringView != arena || Param_findValue(&set, &values[0]) != entry
+        ) {
+            return __LINE__ << 16;
+        }
+        assert(Str, entry->Value.StringView, "ab");
+        // count distinct values with map
+        Param_initValueMap(&map, entries, data, ARRAY_LEN(data), NULL, 0);
+        strcpy(buff, "on, 3, on, 3u, 3");
+        Param_initCursor(&cursor, buff, Str_len(buff), ',');
+        len = Param_parseAll(&cursor, params, ARRAY_LEN(params));
+        for (i = 0; i < len; i++) {
+            if ((count = Param_putKey(&map, &params[i].Value)) == NULL) {
+                return __LINE__ << 16;
+            }
+            count->UNumber += (Param_UNumber) params[i].Index + 1;
+        }
+        if (map.Keys.Len != 3 || (count = Param_findKey(&map, &params[0].Value)) == NULL || count->UNumber != 4 ||
+            (count = Param_findKey(&map, &params[1].Value)) == NULL || count->UNumber != 7 ||
+            (count = Param_findKey(&map, &params[3].Value)) == NULL || count->UNumber != 4
+        ) {
+            return __LINE__ << 16;
+        }
+        Param_clearValueMap(&map);
+        if (Param_findKey(&map, &params[0].Value) != NULL) {
+            return __LINE__ << 16;
+        }
+    }
+#endif
+
+    return 0;
+}
+
+Test_Result Test_25(void) {
+    static const char* const strings[] = { "sensor_temp_b", "sensor_temp_a", "sensor", "a", "", "sensor_temp_a" };
+    Param_Value values[64];
+    Param_Value sorted[64];
+    Param_SortKey keys[128];
+    uint32_t seed = 12345;
+    uint32_t len = 0;
+    uint32_t i, j;
+
+    // documented order
+    setValue(0, Number, -5);
+    setValue(1, UInt8, 3);
+    setValue(2, Boolean, 0);
+    setValue(3, Float, -0.0f);
+    setValue(4, Float, 0.0f);
+    setValue(5, Null, "null");
+    setValue(6, String, "b");
+    setValue(7, Unknown, "x");
+    for (i = 0; i + 1 < 8; i++) {
+        if (Param_orderValue(&values[i], &values[i + 1]) != -1 || Param_orderValue(&values[i + 1], &values[i]) != 1) {
+            return (__LINE__ << 16) | i;
+        }
+    }
+    setValue(0, Number, 3);
+    setView(6, StringView, "b");
+    if (Param_orderValue(&values[0], &values[1]) != -1 || Param_orderValue(&values[0], &values[0]) != 0 ||
+        Param_orderValue(&values[6], &values[6]) != 0
+    ) {
+        return __LINE__ << 16;
+    }
+    // mixed values
+    while (len < 48) {
+        seed = seed * 1103515245 + 12345;
+        switch ((seed >> 16) % 6) {
+            case 0:
+                setValue(len, Number, (Param_Number)(seed >> 8) - (1 << 23));
+                break;
+            case 1:
+                setValue(len, UInt32, seed >> 20);
+                break;
+            case 2:
+                setValue(len, Float, (float)((int32_t)(seed >> 12) - (1 << 19)) / 64);
+                break;
+        #if PARAM_TYPE_64BIT
+            case 3:
+                setValue(len, Int64, -(int64_t)(seed >> 24));
+                break;
+        #endif
+            case 4:
+                setValue(len, String, (char*) strings[(seed >> 20) % ARRAY_LEN(strings)]);
+                break;
+            default:
+                setValue(len, StateKey, (seed >> 20) & 1);
+                break;
+        }
+        len++;
+    }
+    memcpy(sorted, values, len * sizeof(Param_Value));
+    Param_sortValues(sorted, len, keys);
+    for (i = 0; i + 1 < len; i++) {
+        if (Param_orderValue(&sorted[i], &sorted[i + 1]) > 0) {
+            return (__LINE__ << 16) | i;
+        }
+    }
+    // keys keep index of values before sort
+    for (i = 0; i < len; i++) {
+        if (keys[i].Index >= len || Param_orderValue(&values[keys[i].Index], &sorted[i]) != 0) {
+            return (__LINE__ << 16) | i;
+        }
+    }
+    // same values
+    for (i = 0; i < len; i++) {
+        uint32_t before = 0;
+        uint32_t after = 0;
+        for (j = 0; j < len; j++) {
+            before += Param_orderValue(&values[i], &values[j]) == 0;
+            after += Param_orderValue(&values[i], &sorted[j]) == 0;
+        }
+        if (before != after) {
+            return (__LINE__ << 16) | i;
+        }
+    }
+    // small integers
+    for (i = 0; i < 10; i++) {
+        setValue(i, Number, (Param_Number)(9 - i) * 3 % 10);
+    }
+    Param_sortValues(values, 10, keys);
+    for (i = 0; i < 10; i++) {
+        if (values[i].Number != (Param_Number) i) {
+            return (__LINE__ << 16) | i;
+        }
+    }
+
+    return 0;
+}
+
+Test_Result Test_26(void) {
+    char buff[64];
+    char copy[64];
+    Param_Condition conditions[4];
+    Param_Filter filter;
+    Param params[8];
+    Param expected[8];
+    Param_Cursor cursor;
+    Param_LenType len;
+    Param_LenType i;
+
+    // conditions out of order, field 1 == "alarm" and field 2 > 100
+    conditions[0].Index = 2;
+    conditions[0].Op = Param_FilterOp_Greater;
+    conditions[0].Value.Type = Param_ValueType_Number;
+    conditions[0].Value.Number = 100;
+    conditions[1].Index = 1;
+    conditions[1].Op = Param_FilterOp_Equal;
+    conditions[1].Value.Type = Param_ValueType_String;
+    conditions[1].Value.String = "alarm";
+    Param_initFilter(&filter, conditions, 2);
+    if (filter.Conditions[0].Index != 1 || filter.Conditions[1].Index != 2) {
+        return __LINE__ << 16;
+    }
+    // pass, same params as Param_parseAll
+    strcpy(buff, "7, \"alarm\", 150, name, 2.5");
+    strcpy(copy, buff);
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    len = Param_parseFiltered(&cursor, &filter, params, ARRAY_LEN(params));
+    Param_initCursor(&cursor, copy, Str_len(copy), ',');
+    if (len != 5 || Param_parseAll(&cursor, expected, ARRAY_LEN(expected)) != len) {
+        return __LINE__ << 16;
+    }
+    for (i = 0; i < len; i++) {
+        if (params[i].Index != expected[i].Index || params[i].Value.Type != expected[i].Value.Type ||
+            !Param_compareValue(&params[i].Value, &expected[i].Value)
+        ) {
+            return (__LINE__ << 16) | i;
+        }
+    }
+    // drop at field 1, rest of line is not tokenized
+    strcpy(buff, "7, \"info\", 150, name");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseFiltered(&cursor, &filter, params, ARRAY_LEN(params)) != -1 || cursor.Index != 2 ||
+        Str_indexOf(buff + 12, ',') == NULL
+    ) {
+        return __LINE__ << 16;
+    }
+    // drop at field 2, missing field and params array smaller than conditions
+    strcpy(buff, "7, \"alarm\", 50");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseFiltered(&cursor, &filter, params, ARRAY_LEN(params)) != -1) {
+        return __LINE__ << 16;
+    }
+    strcpy(buff, "7, \"alarm\"");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseFiltered(&cursor, &filter, params, ARRAY_LEN(params)) != -1) {
+        return __LINE__ << 16;
+    }
+    strcpy(buff, "7, \"alarm\", 150");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseFiltered(&cursor, &filter, params, 2) != -1) {
+        return __LINE__ << 16;
+    }
+    // all operators on same param, different categories are not ordered
+    for (i = 0; i < 4; i++) {
+        conditions[i].Index = 0;
+        conditions[i].Value.Type = Param_ValueType_Number;
+    }
+    conditions[0].Op = Param_FilterOp_Less;
+    conditions[0].Value.Number = 6;
+    conditions[1].Op = Param_FilterOp_LessEqual;
+    conditions[1].Value.Number = 5;
+    conditions[2].Op = Param_FilterOp_GreaterEqual;
+    conditions[2].Value.Number = 5;
+    conditions[3].Op = Param_FilterOp_NotEqual;
+    conditions[3].Value.Type = Param_ValueType_Float;
+    conditions[3].Value.Float = 5.0f;
+    Param_initFilter(&filter, conditions, 4);
+    strcpy(buff, "5, 1");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseFiltered(&cursor, &filter, params, ARRAY_LEN(params)) != 2 || params[1].Value.Number != 1) {
+        return __LINE__ << 16;
+    }
+    conditions[3].Op = Param_FilterOp_Greater;
+    strcpy(buff, "5, 1");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseFiltered(&cursor, &filter, params, ARRAY_LEN(params)) != -1) {
+        return __LINE__ << 16;
+    }
+    // integers of different widths compare by value
+    conditions[0].Index = 0;
+    conditions[0].Op = Param_FilterOp_LessEqual;
+    conditions[0].Value.Type = Param_ValueType_Number;
+    conditions[0].Value.Number = 5;
+    conditions[1].Index = 0;
+    conditions[1].Op = Param_FilterOp_GreaterEqual;
+    conditions[1].Value.Type = Param_ValueType_UInt16;
+    conditions[1].Value.UInt16 = 5;
+    conditions[2].Index = 1;
+    conditions[2].Op = Param_FilterOp_Greater;
+    conditions[2].Value.Type = Param_ValueType_Int8;
+    conditions[2].Value.Int8 = -4;
+    conditions[3].Index = 2;
+    conditions[3].Op = Param_FilterOp_Less;
+    conditions[3].Value.Type = Param_ValueType_UNumber;
+    conditions[3].Value.UNumber = 301;
+    Param_initFilter(&filter, conditions, 4);
+    strcpy(buff, "5i8, 5u32, 300i16");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseFiltered(&cursor, &filter, params, ARRAY_LEN(params)) != 3 ||
+        params[0].Value.Type != Param_ValueType_Int8 || params[2].Value.Type != Param_ValueType_Int16
+    ) {
+        return __LINE__ << 16;
+    }
+    conditions[3].Value.UNumber = 300;
+    strcpy(buff, "5i8, 5u32, 300i16");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseFiltered(&cursor, &filter, params, ARRAY_LEN(params)) != -1) {
+        return __LINE__ << 16;
+    }
+    // empty filter is Param_parseAll
+    Param_initFilter(&filter, conditions, 0);
+    strcpy(buff, "5, 1");
+    Param_initCursor(&cursor, buff, Str_len(buff), ',');
+    if (Param_parseFiltered(&cursor, &filter, params, ARRAY_LEN(params)) != 2) {
+        return __LINE__ << 16;
+    }
+
+    return 0;
+}
+
 void Result_print(Test_Result result) {
     PRINTF("Line: %u, Index: %u\r\n", result >> 16, result & 0xFFFF);
 }
@@ -317,7 +2431,15 @@ case Param_ValueType_ ##NAME: \
         case Param_ValueType_Boolean:
             PRINTF("%s", val->Boolean ? "true" : "false");
             break;
+        case Param_ValueType_Enum:
+            PRINTF("%u:%u", val->Enum.Table, val->Enum.Ordinal);
+            break;
         __printValue(String, "\"%s\"");
+        case Param_ValueType_StringView:
+        case Param_ValueType_NullView:
+        case Param_ValueType_UnknownView:
+            PRINTF("\"%.*s\"", val->Len, val->StringView);
+            break;
     }
 }
 void Param_print(Param* param) {
@@ -343,7 +2465,11 @@ void Param_print(Param* param) {
         __TYPE_NAME(State),
         __TYPE_NAME(StateKey),
         __TYPE_NAME(Boolean),
+        __TYPE_NAME(Enum),
         __TYPE_NAME(String),
+        __TYPE_NAME(StringView),
+        __TYPE_NAME(NullView),
+        __TYPE_NAME(UnknownView),
     };
 
     PRINTF("{%u, %s, ", param->Index, TYPES[(int) param->Value.Type]);
@@ -378,6 +2504,33 @@ Test_Result Assert_Param(char* buff, Param_Value* values, int len, uint16_t cLin
         return 0;
     }
 }
+Test_Result Assert_ParamView(const char* buff, Param_Value* values, int len, uint16_t cLine) {
+    char copy[200];
+    Param param;
+    Param_Cursor cursor;
+
+    // buffer must not change, and it don't need null terminator
+    Str_copy(copy, buff);
+    Param_initCursorView(&cursor, buff, Str_len(buff), ',');
+    while (Param_nextView(&cursor, &param)) {
+        if (Param_compareValue(&param.Value, values) == 0) {
+            PRINTF("Expected: ");
+            Param_printValue(values);
+            PRINTF(", Found: ");
+            Param_print(&param);
+            PRINTLN("");
+            return cLine << 16 | param.Index;
+        }
+        values++;
+        len--;
+    }
+    if (len > 0 || Str_compare(copy, buff) != 0) {
+        return cLine << 16 | param.Index;
+    }
+    else {
+        return 0;
+    }
+}
 Test_Result Assert_Str(const char* str1, const char* str2, uint16_t line) {
 	if (Str_compare(str1, str2)) {
 		PRINTF("\"%s\"\n", str1);
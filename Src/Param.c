@@ -1,6 +1,26 @@
 #include "Param.h"
+#include "ParamConvert.h"
+#include <string.h>
 
-#define PARAM_DEFAULT_NULL_LEN     (sizeof(PARAM_DEFAULT_NULL) - 1)
+#if PARAM_SIMD == PARAM_SIMD_AVX2
+    #include <immintrin.h>
+#elif PARAM_SIMD == PARAM_SIMD_SSE2
+    #include <emmintrin.h>
+#elif PARAM_SIMD == PARAM_SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+#if PARAM_STATS && PARAM_STATS_CYCLES
+    #if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        #include <intrin.h>
+    #elif defined(__x86_64__) || defined(__i386__)
+        #include <x86intrin.h>
+    #elif !defined(__aarch64__)
+        #include <time.h>
+    #endif
+#endif
+
+#define PARAM_DEFAULT_NULL_LEN    (sizeof(PARAM_DEFAULT_NULL) - 1)
 #define PARAM_DEFAULT_TRUE_LEN     (sizeof(PARAM_DEFAULT_TRUE) - 1)
 #define PARAM_DEFAULT_FALSE_LEN    (sizeof(PARAM_DEFAULT_FALSE) - 1)
 #define PARAM_DEFAULT_OFF_LEN      (sizeof(PARAM_DEFAULT_OFF) - 1)
@@ -9,106 +29,327 @@
 #define PARAM_DEFAULT_LOW_LEN      (sizeof(PARAM_DEFAULT_LOW) - 1)
 #define PARAM_DEFAULT_HEX_LEN      (sizeof(PARAM_DEFAULT_HEX) - 1)
 #define PARAM_DEFAULT_BIN_LEN      (sizeof(PARAM_DEFAULT_BIN) - 1)
+#define PARAM_DEFAULT_DOUBLE_LEN   (sizeof(PARAM_DEFAULT_DOUBLE) - 1)
+/**
+ * @brief buffer size for values with bounded length, ex: binary prefix + 64 digits
+ */
+#define PARAM_VALUE_STR_LEN        80
 
-#if PARAM_CASE_MODE == PARAM_CASE_INSENSITIVE
-    #define __convert(STR) Str_lowerCase((STR))
-#else 
-    #define __convert(STR) 
-#endif // PARAM_CASE_MODE
+#define __PARAM_TYPE_KEYWORD       (PARAM_TYPE_BOOLEAN || PARAM_TYPE_STATE || PARAM_TYPE_STATE_KEY || PARAM_TYPE_NULL)
+#define __PARAM_TYPE_NON_FINITE    (PARAM_TYPE_NUMBER && PARAM_TYPE_FLOAT)
+
+#define __isWhitespace(C)          ((C) == ' ' || ((C) >= '\t' && (C) <= '\r'))
+
+#if PARAM_STATS
+#if defined(__GNUC__) || defined(__clang__)
+    #define __PARAM_THREAD_LOCAL        __thread
+    #define __PARAM_STATS_CLAIM()       __sync_fetch_and_add(&Param_statsUsed, 1)
+    #define __PARAM_STATS_USED()        __sync_fetch_and_add(&Param_statsUsed, 0)
+#elif defined(_MSC_VER)
+    #define __PARAM_THREAD_LOCAL        __declspec(thread)
+    #define __PARAM_STATS_CLAIM()       (uint32_t)(_InterlockedIncrement((volatile long*) &Param_statsUsed) - 1)
+    #define __PARAM_STATS_USED()        (uint32_t) _InterlockedOr((volatile long*) &Param_statsUsed, 0)
+#else
+    // single thread
+    #define __PARAM_THREAD_LOCAL
+    #define __PARAM_STATS_CLAIM()       Param_statsUsed++
+    #define __PARAM_STATS_USED()        Param_statsUsed
+#endif
+
+static Param_Stats Param_statsThreads[PARAM_STATS_THREADS];
+static uint32_t Param_statsUsed = 0;
+static __PARAM_THREAD_LOCAL Param_Stats* Param_statsLocal = NULL;
+static __PARAM_THREAD_LOCAL uint8_t Param_statsClaimed = 0;
+/**
+ * @brief return statistics of current thread, each thread claim one block on first use
+ * threads after PARAM_STATS_THREADS have no block and their counters are dropped, so blocks are never shared
+ *
+ * @return Param_Stats* block of thread, or NULL if thread is dropped
+ */
+static Param_Stats* Param_stats(void) {
+    uint32_t index;
+
+    if (!Param_statsClaimed) {
+        Param_statsClaimed = 1;
+        index = __PARAM_STATS_CLAIM();
+        Param_statsLocal = index < PARAM_STATS_THREADS ? &Param_statsThreads[index] : NULL;
+    }
+    return Param_statsLocal;
+}
+/**
+ * @brief add to counter of current thread
+ */
+#define __PARAM_STATS_ADD_LOCAL(FIELD, N) \
+    do { \
+        Param_Stats* stats = Param_stats(); \
+        if (stats != NULL) { \
+            stats->FIELD += (N); \
+        } \
+    } while (0)
+#if PARAM_STATS_CYCLES
+static uint64_t Param_cycles(void) {
+#if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t value;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r" (value));
+    return value;
+#else
+    return (uint64_t) clock();
+#endif
+}
+#endif // PARAM_STATS_CYCLES
+/**
+ * @brief count parsed token and add its cycles to histogram of parse function
+ *
+ * @param type type of token
+ * @param res result of parse, Param_Error means fallback to unknown
+ * @param cycles
+ */
+static void Param_statsToken(Param_ValueType type, Param_Result res, uint64_t cycles) {
+    Param_Stats* stats = Param_stats();
+#if PARAM_STATS_CYCLES
+    Param_StatsFn fn;
+    uint8_t bucket = 0;
+#endif
+
+    if (stats == NULL) {
+        return;
+    }
+    stats->Tokens[type]++;
+    if (res != Param_Ok) {
+        stats->Unknown++;
+    }
+#if PARAM_STATS_CYCLES
+    if (res != Param_Ok) {
+        fn = Param_StatsFn_Unknown;
+    }
+    else if ((type & Param_Category_Mask) == Param_Category_String) {
+        fn = type == Param_ValueType_String || type == Param_ValueType_StringView ? Param_StatsFn_String : Param_StatsFn_Keyword;
+    }
+    else if ((type & Param_Category_Mask) == Param_Category_Boolean || (type & Param_Category_Mask) == Param_Category_Enum) {
+        fn = Param_StatsFn_Keyword;
+    }
+    else {
+        fn = Param_StatsFn_Number;
+    }
+    while (cycles > 1 && bucket < PARAM_STATS_BUCKETS - 1) {
+        cycles >>= 1;
+        bucket++;
+    }
+    stats->Cycles[fn][bucket]++;
+#else
+    (void) cycles;
+#endif
+}
+/**
+ * @brief aggregate statistics of all threads, counters of running threads may be in progress
+ *
+ * @param stats
+ */
+void Param_statsSnapshot(Param_Stats* stats) {
+    uint32_t used = __PARAM_STATS_USED();
+    uint32_t i, j;
+#if PARAM_STATS_CYCLES
+    uint32_t k;
+#endif
+
+    memset(stats, 0, sizeof(Param_Stats));
+    if (used > PARAM_STATS_THREADS) {
+        stats->Dropped = used - PARAM_STATS_THREADS;
+        used = PARAM_STATS_THREADS;
+    }
+    for (i = 0; i < used; i++) {
+        const Param_Stats* thread = &Param_statsThreads[i];
+        for (j = 0; j < sizeof(stats->Tokens) / sizeof(stats->Tokens[0]); j++) {
+            stats->Tokens[j] += thread->Tokens[j];
+        }
+        stats->Unknown += thread->Unknown;
+        stats->Suffix += thread->Suffix;
+        stats->Bytes += thread->Bytes;
+    #if PARAM_STATS_CYCLES
+        for (j = 0; j < Param_StatsFn_Max; j++) {
+            for (k = 0; k < PARAM_STATS_BUCKETS; k++) {
+                stats->Cycles[j][k] += thread->Cycles[j][k];
+            }
+        }
+    #endif
+    }
+}
+/**
+ * @brief clear statistics of all threads, call it when other threads not parsing
+ */
+void Param_statsReset(void) {
+    memset(Param_statsThreads, 0, sizeof(Param_statsThreads));
+}
+
+    #define __PARAM_STATS_ADD(FIELD, N)     __PARAM_STATS_ADD_LOCAL(FIELD, N)
+#if PARAM_STATS_CYCLES
+    #define __PARAM_STATS_BEGIN()           uint64_t statsCycles = Param_cycles()
+    #define __PARAM_STATS_TOKEN(P, RES)     Param_statsToken((P)->Type, RES, Param_cycles() - statsCycles)
+#else
+    #define __PARAM_STATS_BEGIN()
+    #define __PARAM_STATS_TOKEN(P, RES)     Param_statsToken((P)->Type, RES, 0)
+#endif
+#else
+    #define __PARAM_STATS_ADD(FIELD, N)
+    #define __PARAM_STATS_BEGIN()
+    #define __PARAM_STATS_TOKEN(P, RES)
+#endif // PARAM_STATS
 
 /**
  * @brief initialize the parameter cursor
  * 
  * @param cursor 
  * @param ptr 
- * @param len 
+ * @param len length of string, 0 or negative (wrapped) length continue up to null terminator
  * @param paramSeparator 
  */
 void Param_initCursor(Param_Cursor* cursor, char* ptr, Str_LenType len, char paramSeparator) {
     cursor->Ptr = ptr;
-    cursor->Len = len;
+    cursor->Len = len > 0 ? len : 0;
     cursor->ParamSeparator = paramSeparator;
     cursor->Index = 0;
 }
 /**
- * @brief parse next param and return
+ * @brief initialize the parameter cursor for read-only buffers, use with Param_nextView
+ * buffer don't need to be null terminated
  *
  * @param cursor
- * @param param
- * @return Param* return param
+ * @param ptr
+ * @param len
+ * @param paramSeparator
  */
-Param* Param_next(Param_Cursor* cursor, Param* param) {
+void Param_initCursorView(Param_Cursor* cursor, const char* ptr, Str_LenType len, char paramSeparator) {
+    Param_initCursor(cursor, (char*) ptr, len, paramSeparator);
+}
+static Param_Result Param_parseToken(char* str, Str_LenType len, Param_Value* param);
+#if __PARAM_TYPE_KEYWORD
+/**
+ * @brief keyword in perfect hash table
+ */
+typedef struct {
+    uint64_t            Word;       /**< characters of keyword, first character in low byte */
+    uint8_t             Len;        /**< length of keyword, 0 if slot is empty or type is disabled */
+    uint8_t             Type;
+    uint8_t             Value;
+} Param_Keyword;
+
+static Str_LenType Param_keywordLen(const char* str);
+static const Param_Keyword* Param_findKeyword(const char* str, Str_LenType len);
+static Param_Result Param_parseKeyword(const char* str, Str_LenType len, Param_Value* param);
+#endif
+#if PARAM_TYPE_ENUM
+static Param_Result Param_parseEnum(const char* str, Str_LenType len, Param_Value* param);
+#endif
+#if PARAM_TYPE_NUMBER
+static Param_Result Param_parseNumberToken(const char* str, Str_LenType len, Param_Value* param);
+static const char* Param_scanDecimal(const char* str, const char* end, Param_Decimal* dec, uint8_t* isFloat);
+static int16_t Param_parseNumberSuffix(const char* str, Str_LenType len);
+static Param_Result Param_convertDecimal(const Param_Decimal* dec, Param_Value* param);
+#endif
+#if __PARAM_TYPE_NON_FINITE
+static Param_Result Param_parseNonFinite(const char* str, Str_LenType len, Param_Value* param);
+#endif
+#if PARAM_TYPE_NUMBER_BINARY || PARAM_TYPE_NUMBER_HEX
+static Param_Result Param_parseRadix(const char* str, Str_LenType len, uint8_t shift, Param_UNumber* value);
+#endif
+static int8_t Param_orderByValue(const Param_Value* a, const Param_Value* b);
+/**
+ * @brief move cursor forward, length stay at 0 when it reach end of cursor length
+ * so it never wrap and 0 mean scan up to null terminator
+ *
+ * @param cursor
+ * @param ptr
+ */
+static void Param_moveCursor(Param_Cursor* cursor, char* ptr) {
+    cursor->Len = ptr - cursor->Ptr < cursor->Len ? (Str_LenType)(cursor->Len - (ptr - cursor->Ptr)) : 0;
+    cursor->Ptr = ptr;
+}
+/**
+ * @brief find next param, terminate it and move cursor
+ *
+ * @param cursor
+ * @param len length of param
+ * @return char* param string, or NULL if there is no more params
+ */
+static char* Param_nextToken(Param_Cursor* cursor, Str_LenType* len) {
     char* pStr = cursor->Ptr;
     char* paramStr;
+    char* pEnd;
     // check cursor is valid
     if (cursor->Ptr == NULL || (*cursor->Ptr == '\0' && cursor->Len == 0)) {
         return NULL;
     }
     // ignore whitspaces
-    cursor->Ptr = Str_ignoreWhitespace(cursor->Ptr);
-    cursor->Len -= (Str_LenType)(cursor->Ptr - pStr);
-    // find end of param
+    while (__isWhitespace(*pStr)) {
+        pStr++;
+    }
+    __PARAM_STATS_ADD(Bytes, (uint64_t)(pStr - cursor->Ptr));
+    Param_moveCursor(cursor, pStr);
+    // find end of param, scanner only read inside of cursor length
     paramStr = cursor->Ptr;
-    pStr = Str_indexOf(cursor->Ptr, cursor->ParamSeparator);
-    if (pStr != NULL) {
-        Str_LenType len = (Str_LenType)(pStr - cursor->Ptr);
-        *pStr = '\0';
-        cursor->Ptr = pStr + 1;
-        cursor->Len -= len + 1;
+    pEnd = (char*) Param_scan(paramStr, paramStr + cursor->Len, cursor->ParamSeparator, '\0');
+    // cursor length can be shorter than string, continue up to null terminator
+    while (*pEnd != '\0' && *pEnd != cursor->ParamSeparator) {
+        pEnd++;
+    }
+    __PARAM_STATS_ADD(Bytes, (uint64_t)(pEnd - pStr) + (*pEnd != '\0'));
+    if (*pEnd != '\0') {
+        Param_moveCursor(cursor, pEnd + 1);
     }
     else {
         cursor->Ptr = NULL;
         cursor->Len = 0;
     }
-    // trim right
-    if(*paramStr){
-        paramStr = Str_trimRight(paramStr);
+    // trim right, backward from end of param
+    while (pEnd > paramStr && __isWhitespace(*(pEnd - 1))) {
+        pEnd--;
+    }
+    *pEnd = '\0';
+    *len = (Str_LenType)(pEnd - paramStr);
+    return paramStr;
+}
+/**
+ * @brief parse next param and return
+ *
+ * @param cursor
+ * @param param
+ * @return Param* return param
+ */
+Param* Param_next(Param_Cursor* cursor, Param* param) {
+    Str_LenType len;
+    char* paramStr = Param_nextToken(cursor, &len);
+    if (paramStr == NULL) {
+        return NULL;
     }
     // find value type base on first character
-    Param_parse(paramStr, &param->Value);
+    Param_parseToken(paramStr, len, &param->Value);
     // return param
     param->Index = cursor->Index++;
     return param;
 }
 /**
- * @brief Parse a string into param object
- * 
- * @param str 
- * @param param 
- * @return Param_Result 
+ * @brief find next param without convert it, type of param is guess of first character
+ * and value convert on first Param_getValue, Param_getNumber or Param_getFloat
+ * ex: forward params as raw text and convert only the ones that inspect
+ *
+ * @param cursor
+ * @param param
+ * @return Param_Lazy* return param, or NULL if there is no more params
  */
-Param_Result Param_parse(char* str, Param_Value* param) {
-    Param_Result res = Param_Error;
-
-    switch (*str) {
-    #if PARAM_TYPE_NUMBER
+Param_Lazy* Param_nextLazy(Param_Cursor* cursor, Param_Lazy* param) {
+    Str_LenType len;
+    char* paramStr = Param_nextToken(cursor, &len);
+    if (paramStr == NULL) {
+        return NULL;
+    }
+    switch (*paramStr) {
         case '0':
-        #if PARAM_TYPE_NUMBER_BINARY || PARAM_TYPE_NUMBER_HEX
-            switch (*(str + 1)) {
-            #if PARAM_TYPE_NUMBER_BINARY
-            #if PARAM_CASE_MODE & PARAM_CASE_HIGHER != 0
-                case 'b':
-            #endif
-            #if PARAM_CASE_MODE & PARAM_CASE_HIGHER != 0
-                case 'B':
-            #endif
-                    // binary num
-                    res = Param_parseBinary(str, param);
-                    break;
-            #endif // PARAM_TYPE_NUMBER_BINARY
-            #if PARAM_TYPE_NUMBER_HEX
-            #if PARAM_CASE_MODE & PARAM_CASE_LOWER != 0
-                case 'x':
-            #endif
-            #if PARAM_CASE_MODE & PARAM_CASE_HIGHER != 0
-                case 'X':
-            #endif
-                    // hex num
-                    res = Param_parseHex(str, param);
-                    break;
-            #endif // PARAM_TYPE_NUMBER_HEX
-            }
-        #endif // PARAM_TYPE_NUMBER_BINARY || PARAM_TYPE_NUMBER_HEX
+            param->Param.Value.Type = paramStr[1] == 'x' || paramStr[1] == 'X' ? Param_ValueType_NumberHex :
+                                      paramStr[1] == 'b' || paramStr[1] == 'B' ? Param_ValueType_NumberBinary :
+                                                                                 Param_ValueType_Number;
+            break;
         case '1':
         case '2':
         case '3':
@@ -119,361 +360,2031 @@ Param_Result Param_parse(char* str, Param_Value* param) {
         case '8':
         case '9':
         case '-':
-            // check for number or its float
-            if (res != Param_Ok) {
-                res = Param_parseNum(str, param);
-            }
-            break;
-    #endif // PARAM_TYPE_NUMBER
-    #if PARAM_TYPE_BOOLEAN
-    #if PARAM_CASE_MODE & PARAM_CASE_LOWER != 0
-        case 't':
-        case 'f':
-    #endif
-    #if PARAM_CASE_MODE & PARAM_CASE_HIGHER != 0
-        case 'T':
-        case 'F':
-    #endif
-            // boolean
-            res = Param_parseBoolean(str, param);
-            break;
-    #endif // PARAM_TYPE_BOOLEAN
-    #if PARAM_TYPE_STATE
-    #if PARAM_CASE_MODE & PARAM_CASE_LOWER != 0
-        case 'o':
-    #endif
-    #if PARAM_CASE_MODE & PARAM_CASE_HIGHER != 0
-        case 'O':
-    #endif
-            // state
-            res = Param_parseStateKey(str, param);
-            break;
-    #endif // PARAM_TYPE_STATE
-    #if PARAM_TYPE_STATE_KEY
-    #if PARAM_CASE_MODE & PARAM_CASE_LOWER != 0
-        case 'l':
-        case 'h':
-    #endif
-    #if PARAM_CASE_MODE & PARAM_CASE_HIGHER != 0
-        case 'L':
-        case 'H':
-    #endif
-            // state key
-            res = Param_parseState(str, param);
+            param->Param.Value.Type = Param_ValueType_Number;
             break;
-    #endif // PARAM_TYPE_STATE_KEY
-    #if PARAM_TYPE_STRING
         case '"':
-            // string
-            res = Param_parseString(str, param);
+            param->Param.Value.Type = Param_ValueType_String;
             break;
-    #endif // PARAM_TYPE_STRING
-    #if PARAM_TYPE_NULL
-    #if PARAM_CASE_MODE & PARAM_CASE_LOWER != 0
-        case 'n':
-    #endif
-    #if PARAM_CASE_MODE & PARAM_CASE_HIGHER != 0
-        case 'N':
-    #endif
-            res = Param_parseNull(str, param);
+        default:
+            // keywords and enums resolve on conversion
+            param->Param.Value.Type = Param_ValueType_Unknown;
             break;
-    #endif // PARAM_TYPE_NULL
-    }
-
-    // check if param is not valid
-    if (res != Param_Ok) {
-        Param_parseUnknown(str, param);
     }
-
-    return res;
+    param->Param.Index = cursor->Index++;
+    param->Str = paramStr;
+    param->Len = len;
+    param->Parsed = 0;
+    return param;
 }
-#if PARAM_TYPE_NUMBER_BINARY
 /**
- * @brief parse binary strings
- * ex: "0b1010" -> 0xA
+ * @brief convert value of lazy param once and return it
  *
- * @param cursor
  * @param param
- * @return Param_Result
+ * @return Param_Value*
  */
-Param_Result Param_parseBinary(char* str, Param_Value* param) {
-    param->Type = Param_ValueType_NumberBinary;
-#if PARAM_TYPE_64BIT
-    return (Param_Result) Str_convertULong(str + 2, &param->NumberBinary, Str_Binary);
-#else
-    return (Param_Result) Str_convertUNum(str + 2, &param->NumberBinary, Str_Binary);
-#endif
+Param_Value* Param_getValue(Param_Lazy* param) {
+    if (!param->Parsed) {
+        Param_parseToken(param->Str, param->Len, &param->Param.Value);
+        param->Parsed = 1;
+    }
+    return &param->Param.Value;
 }
-#endif // PARAM_TYPE_NUMBER_BINARY
-#if PARAM_TYPE_NUMBER_HEX
 /**
- * @brief parse hex strings
- * ex: "0xA" -> 0xA
+ * @brief return value of lazy param as number, value convert on first call
  *
- * @param cursor
  * @param param
- * @return Param_Result
+ * @param value
+ * @return Param_Result Param_Error if param is not integer or not fit in Param_Number
  */
-Param_Result Param_parseHex(char* str, Param_Value* param) {
-    param->Type = Param_ValueType_NumberHex;
-#if PARAM_TYPE_64BIT
-    return (Param_Result) Str_convertULong(str + 2, &param->NumberHex, Str_Hex);
-#else
-    return (Param_Result) Str_convertUNum(str + 2, &param->NumberHex, Str_Hex);
-#endif
+Param_Result Param_getNumber(Param_Lazy* param, Param_Number* value) {
+#define __signedCase(TY) \
+    case Param_ValueType_ ##TY: \
+        *value = (Param_Number) val->TY; \
+        return Param_Ok
+#define __unsignedCase(TY) \
+    case Param_ValueType_ ##TY: \
+        if ((Param_UNumber) val->TY > (~(Param_UNumber) 0 >> 1)) { \
+            return Param_Error; \
+        } \
+        *value = (Param_Number) val->TY; \
+        return Param_Ok
+
+    Param_Value* val = Param_getValue(param);
+
+    switch (val->Type) {
+        __signedCase(Number);
+        __signedCase(Int8);
+        __signedCase(Int16);
+        __signedCase(Int32);
+        __unsignedCase(UNumber);
+        __unsignedCase(NumberHex);
+        __unsignedCase(NumberBinary);
+        __unsignedCase(UInt8);
+        __unsignedCase(UInt16);
+        __unsignedCase(UInt32);
+    #if PARAM_TYPE_64BIT
+        __signedCase(Int64);
+        __unsignedCase(UInt64);
+    #endif
+        default:
+            return Param_Error;
+    }
+#undef __signedCase
+#undef __unsignedCase
 }
-#endif // PARAM_TYPE_NUMBER_HEX
-#if PARAM_TYPE_NUMBER
 /**
- * @brief parse number strings
- * ex: "123" -> 123
+ * @brief return value of lazy param as float, integers are converted too
  *
- * @param cursor
  * @param param
- * @return Param_Result
+ * @param value
+ * @return Param_Result Param_Error if param is not number
  */
-Param_Result Param_parseNum(char* str, Param_Value* param) {
-    typedef enum {
-        __Ending_f,
-        __Ending_f32,
-    #if PARAM_TYPE_64BIT
-        __Ending_f64,
-    #endif
-        __Ending_i,
-        __Ending_i16,
-        __Ending_i32,
-    #if PARAM_TYPE_64BIT
-        __Ending_i64,
-    #endif
-        __Ending_i8,
-        __Ending_u,
-        __Ending_u16,
-        __Ending_u32,
-    #if PARAM_TYPE_64BIT
-        __Ending_u64,
-    #endif
-        __Ending_u8,
-    } __Ending;
-#define __IMPL_ENDING_NAME(NAME)             [__Ending_ ##NAME] = #NAME
-    static const char* ENDING[] = {
-        __IMPL_ENDING_NAME(u),
-        __IMPL_ENDING_NAME(i),
-        __IMPL_ENDING_NAME(u8),
-        __IMPL_ENDING_NAME(i8),
-        __IMPL_ENDING_NAME(u16),
-        __IMPL_ENDING_NAME(i16),
-        __IMPL_ENDING_NAME(u32),
-        __IMPL_ENDING_NAME(i32),
-    #if PARAM_TYPE_64BIT
-        __IMPL_ENDING_NAME(u64),
-        __IMPL_ENDING_NAME(i64),
-    #endif
-        __IMPL_ENDING_NAME(f),
-        __IMPL_ENDING_NAME(f32),
-    #if PARAM_TYPE_64BIT
-        __IMPL_ENDING_NAME(f64),
-    #endif
-    };
-#define __IMPL_ENDING_TYPE(NAME, TY)             [__Ending_ ##NAME] = Param_ValueType_ ##TY
-    static uint8_t ENDING_TYPE[] = {
-        __IMPL_ENDING_TYPE(u, UNumber),
-        __IMPL_ENDING_TYPE(i, Number),
-        __IMPL_ENDING_TYPE(u8, UInt8),
-        __IMPL_ENDING_TYPE(i8, Int8),
-        __IMPL_ENDING_TYPE(u16, UInt16),
-        __IMPL_ENDING_TYPE(i16, Int16),
-        __IMPL_ENDING_TYPE(u32, UInt32),
-        __IMPL_ENDING_TYPE(i32, Int32),
-    #if PARAM_TYPE_64BIT
-        __IMPL_ENDING_TYPE(u64, UInt64),
-        __IMPL_ENDING_TYPE(i64, Int64),
-    #endif
-        __IMPL_ENDING_TYPE(f, Float),
-        __IMPL_ENDING_TYPE(f32, Float),
-    #if PARAM_TYPE_64BIT
-        __IMPL_ENDING_TYPE(f64, Double),
-        #endif
-    };
-
-    // Try find Ending
-    param->Type = Param_ValueType_Unknown;
-    Str_LenType ending = Str_linearSearch(ENDING, sizeof(ENDING) / sizeof(ENDING[0]), str, Str_endsWith);
-    if (ending >= 0) {
-        // Ending found
-        param->Type = ENDING_TYPE[ending];
-        // Set null at ending
-        str[Str_len(str) - Str_len(ENDING[ending])] = '\0';
-    }
+Param_Result Param_getFloat(Param_Lazy* param, float* value) {
+    Param_Value* val = Param_getValue(param);
+    Param_Number num;
 
-#if PARAM_TYPE_64BIT
-    if (param->Type == Param_ValueType_Double) {
-        return (Param_Result) Str_convertDouble(str, &param->Double);
-    }
-    else
-#endif
-    if (param->Type == Param_ValueType_Float || Str_indexOf(str, '.') != NULL) {
-        // it's float
-        param->Type = Param_ValueType_Float;
-        return (Param_Result) Str_convertFloat(str, &param->Float);
-    }
-    else {
-        // it's number
-        if (param->Type == Param_ValueType_Unknown) {
-            param->Type = Param_ValueType_Number;
-        }
-        
+    switch (val->Type) {
+        case Param_ValueType_Float:
+            *value = val->Float;
+            return Param_Ok;
     #if PARAM_TYPE_64BIT
-        return (Param_Result) Str_convertLong(str, &param->Number, Str_Decimal);
-    #else
-        return (Param_Result) Str_convertNum(str, &param->Number, Str_Decimal);
+        case Param_ValueType_Double:
+            *value = (float) val->Double;
+            return Param_Ok;
     #endif
+        default:
+            if (Param_getNumber(param, &num) != Param_Ok) {
+                return Param_Error;
+            }
+            *value = (float) num;
+            return Param_Ok;
     }
 }
-#endif // PARAM_TYPE_NUMBER
-#if PARAM_TYPE_STRING
+#if PARAM_TYPE_64BIT
 /**
- * @brief parse strings
- * ex: "\"Text\"" -> "Text"
+ * @brief return value of lazy param as double, integers are converted too
  *
- * @param cursor
  * @param param
- * @return Param_Result
+ * @param value
+ * @return Param_Result Param_Error if param is not number
  */
-Param_Result Param_parseString(char* str, Param_Value* param) {
-    Str_LenType len = Str_fromString(str);
-    if (len != -1) {
-        param->Type = Param_ValueType_String;
-        param->String = str;
-        return Param_Ok;
-    }
-    else {
-        return Param_Error;
+Param_Result Param_getDouble(Param_Lazy* param, double* value) {
+    Param_Value* val = Param_getValue(param);
+    Param_Number num;
+
+    switch (val->Type) {
+        case Param_ValueType_Float:
+            *value = val->Float;
+            return Param_Ok;
+        case Param_ValueType_Double:
+            *value = val->Double;
+            return Param_Ok;
+        default:
+            if (Param_getNumber(param, &num) != Param_Ok) {
+                return Param_Error;
+            }
+            *value = (double) num;
+            return Param_Ok;
     }
 }
-#endif // PARAM_TYPE_STRING
-#if PARAM_TYPE_STATE
+#endif
 /**
- * @brief parse state strings
- * ex: "high" -> 1 or "low" -> 0
+ * @brief parse params up to len into params array,
+ * params tokenized in batches of PARAM_BATCH_SIZE and then parsed
+ * cursor stay on next param if array is full
  *
  * @param cursor
- * @param param
- * @return Param_Result
+ * @param params
+ * @param len maximum number of params
+ * @return Param_LenType number of parsed params
  */
-Param_Result Param_parseState(char* str, Param_Value* param) {
-    __convert(str);
-    param->Type = Param_ValueType_State;
-    if (
-    #if PARAM_CASE_MODE == PARAM_CASE_LOWER
-        Str_compare(str, "high") == 0
-    #elif PARAM_CASE_MODE == PARAM_CASE_HIGHER
-        Str_compare(str, "HIGH") == 0
+Param_LenType Param_parseAll(Param_Cursor* cursor, Param* params, Param_LenType len) {
+    char* tokens[PARAM_BATCH_SIZE];
+    Str_LenType lens[PARAM_BATCH_SIZE];
+    Param_LenType count = 0;
+    Param_LenType batch;
+    Param_LenType i;
+
+    do {
+        // tokenize
+        batch = 0;
+        while (batch < PARAM_BATCH_SIZE && count + batch < len &&
+            (tokens[batch] = Param_nextToken(cursor, &lens[batch])) != NULL) {
+            batch++;
+        }
+        // parse
+        for (i = 0; i < batch; i++) {
+            Param_parseToken(tokens[i], lens[i], &params->Value);
+            params->Index = cursor->Index++;
+            params++;
+        }
+        count += batch;
+    } while (batch == PARAM_BATCH_SIZE);
+
+    return count;
+}
+/**
+ * @brief parse params up to len into parallel arrays of types and values,
+ * index of param is cursor index plus array index
+ *
+ * @param cursor
+ * @param types
+ * @param values
+ * @param len maximum number of params
+ * @return Param_LenType number of parsed params
+ */
+Param_LenType Param_parseAllValues(Param_Cursor* cursor, Param_ValueType* types, Param_ValueData* values, Param_LenType len) {
+    char* tokens[PARAM_BATCH_SIZE];
+    Str_LenType lens[PARAM_BATCH_SIZE];
+    Param_Value value;
+    Param_LenType count = 0;
+    Param_LenType batch;
+    Param_LenType i;
+
+    do {
+        // tokenize
+        batch = 0;
+        while (batch < PARAM_BATCH_SIZE && count + batch < len &&
+            (tokens[batch] = Param_nextToken(cursor, &lens[batch])) != NULL) {
+            batch++;
+        }
+        // parse
+        for (i = 0; i < batch; i++) {
+            Param_parseToken(tokens[i], lens[i], &value);
+            *types++ = value.Type;
+            memcpy(values++, &value, sizeof(Param_ValueData));
+        }
+        cursor->Index += batch;
+        count += batch;
+    } while (batch == PARAM_BATCH_SIZE);
+
+    return count;
+}
+/**
+ * @brief compile filter, conditions sort by index so Param_parseFiltered check them in one pass of line
+ * conditions on same param keep their order
+ *
+ * @param filter
+ * @param conditions
+ * @param len number of conditions
+ */
+void Param_initFilter(Param_Filter* filter, Param_Condition* conditions, Param_LenType len) {
+    Param_Condition condition;
+    Param_LenType i;
+    Param_LenType j;
+
+    for (i = 1; i < len; i++) {
+        condition = conditions[i];
+        for (j = i; j > 0 && conditions[j - 1].Index > condition.Index; j--) {
+            conditions[j] = conditions[j - 1];
+        }
+        conditions[j] = condition;
+    }
+    filter->Conditions = conditions;
+    filter->Len = len;
+}
+/**
+ * @brief check condition on value, values with different types are not equal same as Param_compareValue,
+ * ordered operators compare values of same category by value, ex: 5i8 and 5i32 are equal for LessEqual
+ *
+ * @param condition
+ * @param value
+ * @return uint8_t 1 if condition is true
+ */
+static uint8_t Param_checkCondition(Param_Condition* condition, Param_Value* value) {
+    int8_t order;
+
+    switch (condition->Op) {
+        case Param_FilterOp_Equal:
+            return Param_compareValue(value, &condition->Value) != 0;
+        case Param_FilterOp_NotEqual:
+            return Param_compareValue(value, &condition->Value) == 0;
+        default:
+            break;
+    }
+    if ((value->Type & Param_Category_Mask) != (condition->Value.Type & Param_Category_Mask)) {
+        return 0;
+    }
+    order = Param_orderByValue(value, &condition->Value);
+    switch (condition->Op) {
+        case Param_FilterOp_Less:
+            return order < 0;
+        case Param_FilterOp_LessEqual:
+            return order <= 0;
+        case Param_FilterOp_Greater:
+            return order > 0;
+        case Param_FilterOp_GreaterEqual:
+            return order >= 0;
+        default:
+            return 0;
+    }
+}
+/**
+ * @brief parse params up to len like Param_parseAll if line pass filter,
+ * params of conditions parse while tokenizing and line drop at first false condition,
+ * other params before last condition only parse when line pass filter
+ * and params after last condition don't touch for dropped lines
+ *
+ * @param cursor
+ * @param filter compiled filter, conditions on params after len are false
+ * @param params
+ * @param len maximum number of params
+ * @return Param_LenType number of parsed params, or -1 if line dropped, cursor stay in middle of line
+ */
+Param_LenType Param_parseFiltered(Param_Cursor* cursor, const Param_Filter* filter, Param* params, Param_LenType len) {
+    Param_Condition* condition = filter->Conditions;
+    Param_Condition* conditionEnd = filter->Conditions + filter->Len;
+    Param_LenType count = 0;
+    Param_LenType i;
+    Str_LenType tokenLen;
+    char* token;
+
+    // tokenize up to last condition
+    while (condition < conditionEnd) {
+        if (condition->Index < cursor->Index || count >= len ||
+            (token = Param_nextToken(cursor, &tokenLen)) == NULL
+        ) {
+            return -1;
+        }
+        params[count].Index = cursor->Index++;
+        if (params[count].Index == condition->Index) {
+            Param_parseToken(token, tokenLen, &params[count].Value);
+            do {
+                if (!Param_checkCondition(condition, &params[count].Value)) {
+                    return -1;
+                }
+                condition++;
+            } while (condition < conditionEnd && condition->Index == params[count].Index);
+        }
+        else {
+            // keep token until line pass filter
+            params[count].Value.String = token;
+            params[count].Value.Len = tokenLen;
+        }
+        count++;
+    }
+    // parse kept tokens
+    condition = filter->Conditions;
+    for (i = 0; i < count; i++) {
+        while (condition < conditionEnd && condition->Index < params[i].Index) {
+            condition++;
+        }
+        if (condition == conditionEnd || condition->Index != params[i].Index) {
+            Param_parseToken(params[i].Value.String, params[i].Value.Len, &params[i].Value);
+        }
+    }
+
+    return count + Param_parseAll(cursor, &params[count], len - count);
+}
+#if PARAM_TYPE_NUMBER
+/**
+ * @brief convert scanned integer to field type, value must fit in field
+ *
+ * @param dec
+ * @param type integer type of field
+ * @param dst
+ * @return Param_Result
+ */
+static Param_Result Param_storeInteger(const Param_Decimal* dec, Param_ValueType type, void* dst) {
+#define __storeIntegerCase(TY, BITS, SIGNED) \
+    case Param_ValueType_ ##TY: \
+        bits = BITS; \
+        isSigned = SIGNED; \
+        break
+
+#define __storeCase(TY) \
+    case Param_ValueType_ ##TY: \
+        *(PARAM_VALUETYPE(TY)*) dst = (PARAM_VALUETYPE(TY)) value; \
+        break
+
+    Param_UNumber limit;
+    Param_UNumber value;
+    uint8_t bits;
+    uint8_t isSigned;
+
+    switch (type) {
+        __storeIntegerCase(Number, sizeof(Param_Number) * 8, 1);
+        __storeIntegerCase(UNumber, sizeof(Param_UNumber) * 8, 0);
+        __storeIntegerCase(Int8, 8, 1);
+        __storeIntegerCase(UInt8, 8, 0);
+        __storeIntegerCase(Int16, 16, 1);
+        __storeIntegerCase(UInt16, 16, 0);
+        __storeIntegerCase(Int32, 32, 1);
+        __storeIntegerCase(UInt32, 32, 0);
+    #if PARAM_TYPE_64BIT
+        __storeIntegerCase(Int64, 64, 1);
+        __storeIntegerCase(UInt64, 64, 0);
+    #endif
+        default:
+            return Param_Error;
+    }
+    limit = (Param_UNumber) ~((Param_UNumber) 0) >> (sizeof(Param_UNumber) * 8 - bits + isSigned);
+    if (dec->Negative) {
+        limit = isSigned ? limit + 1 : 0;
+    }
+    if (dec->Truncated || dec->Exponent != 0 || dec->Mantissa > limit) {
+        return Param_Error;
+    }
+    value = dec->Negative ? (Param_UNumber) 0 - (Param_UNumber) dec->Mantissa : (Param_UNumber) dec->Mantissa;
+    switch (type) {
+        __storeCase(Number);
+        __storeCase(UNumber);
+        __storeCase(Int8);
+        __storeCase(UInt8);
+        __storeCase(Int16);
+        __storeCase(UInt16);
+        __storeCase(Int32);
+        __storeCase(UInt32);
+    #if PARAM_TYPE_64BIT
+        __storeCase(Int64);
+        __storeCase(UInt64);
+    #endif
+        default:
+            break;
+    }
+    return Param_Ok;
+#undef __storeCase
+#undef __storeIntegerCase
+}
+#endif // PARAM_TYPE_NUMBER
+/**
+ * @brief convert token directly with converter of field type
+ *
+ * @param str null terminated token
+ * @param len length of token
+ * @param type type of field
+ * @param dst address of field
+ * @return Param_Result
+ */
+static Param_Result Param_parseField(char* str, Str_LenType len, Param_ValueType type, void* dst) {
+    Param_Value value;
+#if __PARAM_TYPE_KEYWORD
+    const Param_Keyword* keyword;
+#endif
+#if PARAM_TYPE_NUMBER
+    Param_Decimal dec;
+    const char* pStr;
+    uint8_t isFloat;
+    int16_t suffix;
+#endif
+
+    switch (type) {
+    #if PARAM_TYPE_NUMBER
+        case Param_ValueType_Number:
+        case Param_ValueType_UNumber:
+        case Param_ValueType_Int8:
+        case Param_ValueType_UInt8:
+        case Param_ValueType_Int16:
+        case Param_ValueType_UInt16:
+        case Param_ValueType_Int32:
+        case Param_ValueType_UInt32:
+    #if PARAM_TYPE_64BIT
+        case Param_ValueType_Int64:
+        case Param_ValueType_UInt64:
+    #endif
+            pStr = Param_scanDecimal(str, str + len, &dec, &isFloat);
+            if (pStr == NULL || isFloat) {
+                return Param_Error;
+            }
+            // suffix is optional, but must match with field
+            suffix = Param_parseNumberSuffix(pStr, (Str_LenType)(str + len - pStr));
+            if (suffix != Param_ValueType_Unknown && suffix != (int16_t) type) {
+                return Param_Error;
+            }
+            return Param_storeInteger(&dec, type, dst);
+        case Param_ValueType_Float:
+    #if PARAM_TYPE_64BIT
+        case Param_ValueType_Double:
+    #endif
+            pStr = Param_scanDecimal(str, str + len, &dec, &isFloat);
+            if (pStr == NULL) {
+            #if __PARAM_TYPE_NON_FINITE
+                if (Param_parseNonFinite(str, len, &value) != Param_Ok) {
+                    return Param_Error;
+                }
+            #if PARAM_TYPE_64BIT
+                if (value.Type != type) {
+                    // Inf without suffix to double field
+                    if (value.Type != Param_ValueType_Float) {
+                        return Param_Error;
+                    }
+                    value.Double = (double) value.Float;
+                }
+            #endif
+            #else
+                return Param_Error;
+            #endif
+            }
+            else {
+                suffix = Param_parseNumberSuffix(pStr, (Str_LenType)(str + len - pStr));
+                if (suffix != Param_ValueType_Unknown && suffix != (int16_t) type) {
+                    return Param_Error;
+                }
+                value.Type = type;
+                if (Param_convertDecimal(&dec, &value) != Param_Ok) {
+                    return Param_Error;
+                }
+            }
+        #if PARAM_TYPE_64BIT
+            if (type == Param_ValueType_Double) {
+                *(double*) dst = value.Double;
+                return Param_Ok;
+            }
+        #endif
+            *(float*) dst = value.Float;
+            return Param_Ok;
+    #endif // PARAM_TYPE_NUMBER
+    #if PARAM_TYPE_NUMBER_HEX
+        case Param_ValueType_NumberHex:
+            if (len <= 2 || str[0] != '0' || (str[1] | 0x20) != 'x') {
+                return Param_Error;
+            }
+            return Param_parseRadix(str + 2, len - 2, 4, (Param_UNumber*) dst);
+    #endif
+    #if PARAM_TYPE_NUMBER_BINARY
+        case Param_ValueType_NumberBinary:
+            if (len <= 2 || str[0] != '0' || (str[1] | 0x20) != 'b') {
+                return Param_Error;
+            }
+            return Param_parseRadix(str + 2, len - 2, 1, (Param_UNumber*) dst);
+    #endif
+    #if PARAM_TYPE_STRING
+        case Param_ValueType_String:
+            if (*str != '"' || Param_parseString(str, &value) != Param_Ok) {
+                return Param_Error;
+            }
+            *(char**) dst = value.String;
+            return Param_Ok;
+    #endif
+    #if __PARAM_TYPE_KEYWORD
+        case Param_ValueType_Boolean:
+        case Param_ValueType_State:
+        case Param_ValueType_StateKey:
+        case Param_ValueType_Null:
+            keyword = Param_findKeyword(str, len);
+            if (keyword == NULL || keyword->Type != type) {
+                return Param_Error;
+            }
+            if (type == Param_ValueType_Null) {
+                *(char**) dst = str;
+            }
+            else {
+                *(uint8_t*) dst = keyword->Value;
+            }
+            return Param_Ok;
+    #endif // __PARAM_TYPE_KEYWORD
+    #if PARAM_TYPE_ENUM
+        case Param_ValueType_Enum:
+            if (Param_parseEnum(str, len, &value) != Param_Ok) {
+                return Param_Error;
+            }
+            *(Param_Enum*) dst = value.Enum;
+            return Param_Ok;
+    #endif
+        case Param_ValueType_Unknown:
+            *(char**) dst = str;
+            return Param_Ok;
+        default:
+            return Param_Error;
+    }
+}
+/**
+ * @brief parse params with known layout directly into fields of a struct, no type detection and no Param_Value
+ * ex: struct { int32_t Id; float Value; char* Name; uint8_t Enable; } with "12, 2.5, \"Name\", on"
+ *
+ * @param cursor
+ * @param schema type and offset of fields, in order of params
+ * @param dst destination struct
+ * @return Param_LenType number of fields that parsed, equal to schema->Len on success,
+ * otherwise index of field that param is missing or not match
+ */
+Param_LenType Param_parseInto(Param_Cursor* cursor, const Param_Schema* schema, void* dst) {
+    const Param_Field* field = schema->Fields;
+    Param_LenType index;
+    Str_LenType len;
+    char* paramStr;
+
+    for (index = 0; index < schema->Len; index++, field++) {
+        paramStr = Param_nextToken(cursor, &len);
+        if (paramStr == NULL ||
+            Param_parseField(paramStr, len, field->Type, (uint8_t*) dst + field->Offset) != Param_Ok
+        ) {
+            break;
+        }
+        cursor->Index++;
+    }
+
+    return index;
+}
+/**
+ * @brief initialize cursor over records, buffer modify in place like Param_Cursor
+ *
+ * @param table
+ * @param ptr null terminated buffer
+ * @param len length of buffer
+ * @param recordSeparator ex: '\n'
+ * @param paramSeparator ex: ','
+ */
+void Param_initTableCursor(Param_TableCursor* table, char* ptr, size_t len, char recordSeparator, char paramSeparator) {
+    table->Ptr = ptr;
+    table->Len = len;
+    table->Record = 0;
+    table->RecordSeparator = recordSeparator;
+    table->ParamSeparator = paramSeparator;
+}
+/**
+ * @brief initialize cursor on next record, record separator replace with null terminator
+ *
+ * @param table
+ * @param cursor
+ * @return Param_Cursor* return cursor, or NULL if there is no more records
+ */
+Param_Cursor* Param_nextRow(Param_TableCursor* table, Param_Cursor* cursor) {
+    char* pEnd;
+    size_t len;
+    Str_LenType cursorLen;
+
+    if (table->Ptr == NULL || table->Len == 0) {
+        return NULL;
+    }
+    pEnd = (char*) memchr(table->Ptr, table->RecordSeparator, table->Len);
+    len = pEnd != NULL ? (size_t)(pEnd - table->Ptr) : table->Len;
+    // records longer than cursor length continue up to null terminator
+    cursorLen = (Str_LenType) len;
+    if ((size_t) cursorLen != len) {
+        cursorLen = 0;
+    }
+    Param_initCursor(cursor, table->Ptr, cursorLen, table->ParamSeparator);
+    if (pEnd != NULL) {
+        *pEnd = '\0';
+        table->Ptr = pEnd + 1;
+        table->Len -= len + 1;
+    }
+    else {
+        table->Ptr = NULL;
+        table->Len = 0;
+    }
+    table->Record++;
+    return cursor;
+}
+/**
+ * @brief initialize columns of columnar output
+ *
+ * @param columns
+ * @param column array of columns, define each one with PARAM_COLUMN
+ * @param len number of columns
+ * @param size number of rows that each column can hold
+ */
+void Param_initColumns(Param_Columns* columns, Param_Column* column, Param_LenType len, uint32_t size) {
+    columns->Columns = column;
+    columns->Len = len;
+    columns->Rows = 0;
+    columns->Size = size;
+}
+/**
+ * @brief parse records into columns, param i of each record convert with type of column i
+ * and store in row of column values. missing params and params that not match column type
+ * store as zero and clear in validity bitmap, extra params of record are ignored
+ *
+ * @param table
+ * @param columns
+ * @return uint32_t number of rows that parsed, less than free rows of columns when table finished
+ */
+uint32_t Param_parseColumns(Param_TableCursor* table, Param_Columns* columns) {
+    Param_Cursor cursor;
+    Param_Column* column;
+    Param_LenType index;
+    Str_LenType len;
+    uint32_t start = columns->Rows;
+    uint32_t row;
+    uint8_t* dst;
+    uint8_t mask;
+    char* paramStr;
+
+    while (columns->Rows < columns->Size && Param_nextRow(table, &cursor) != NULL) {
+        row = columns->Rows++;
+        mask = (uint8_t)(1 << (row & 7));
+        column = columns->Columns;
+        for (index = 0; index < columns->Len; index++, column++) {
+            dst = (uint8_t*) column->Values + (size_t) row * column->Size;
+            paramStr = Param_nextToken(&cursor, &len);
+            if (paramStr != NULL && Param_parseField(paramStr, len, column->Type, dst) == Param_Ok) {
+                if (column->Valid != NULL) {
+                    column->Valid[row >> 3] |= mask;
+                }
+            }
+            else {
+                memset(dst, 0, column->Size);
+                if (column->Valid != NULL) {
+                    column->Valid[row >> 3] &= (uint8_t) ~mask;
+                }
+            }
+        }
+    }
+
+    return columns->Rows - start;
+}
+/**
+ * @brief initialize key=value params
+ *
+ * @param keyValues
+ * @param params array of params
+ * @param size size of params, limited to PARAM_KEY_INDEX_SIZE / 2
+ * @param lazy convert values only when Param_find them
+ */
+void Param_initKeyValues(Param_KeyValues* keyValues, Param_KeyValue* params, Param_LenType size, uint8_t lazy) {
+    keyValues->Params = params;
+    keyValues->Len = 0;
+    keyValues->Size = size < PARAM_KEY_INDEX_SIZE / 2 ? size : PARAM_KEY_INDEX_SIZE / 2;
+    keyValues->Lazy = lazy;
+    keyValues->Truncated = 0;
+    memset(keyValues->Index, 0xFF, sizeof(keyValues->Index));
+}
+#define __keyHashInit                   0x811C9DC5UL
+#define __keyHashStep(H, C)             (((H) ^ (uint8_t)(C)) * 0x01000193UL)
+/**
+ * @brief find slot of key in index
+ *
+ * @param keyValues
+ * @param key
+ * @param hash
+ * @return Param_LenType* slot of key, or empty slot
+ */
+static Param_LenType* Param_findKeySlot(Param_KeyValues* keyValues, const char* key, uint32_t hash) {
+    Param_LenType* slot;
+    Param_KeyValue* param;
+    uint16_t index = (uint16_t)(hash & (PARAM_KEY_INDEX_SIZE - 1));
+
+    for (;;) {
+        slot = &keyValues->Index[index];
+        if (*slot < 0) {
+            return slot;
+        }
+        param = &keyValues->Params[*slot];
+        if (param->Hash == hash && Str_compare(param->Key, key) == 0) {
+            return slot;
+        }
+        index = (index + 1) & (PARAM_KEY_INDEX_SIZE - 1);
+    }
+}
+/**
+ * @brief parse key=value params and index keys, key hashed while searching for separator
+ * params without separator have NULL key, for duplicate keys Param_find return first one
+ * ex: "rssi=-70, mode=auto, 12"
+ *
+ * @param cursor
+ * @param keyValues
+ * @return Param_LenType number of parsed params, Truncated is set if params are full before end of line
+ */
+Param_LenType Param_parseKeyValues(Param_Cursor* cursor, Param_KeyValues* keyValues) {
+    Param_KeyValue* param;
+    Param_LenType* slot;
+    Str_LenType len;
+    char* paramStr;
+    char* pStr;
+    char* keyEnd;
+    uint32_t hash;
+    uint32_t keyHash;
+
+    while (keyValues->Len < keyValues->Size && (paramStr = Param_nextToken(cursor, &len)) != NULL) {
+        param = &keyValues->Params[keyValues->Len];
+        // find separator and hash key, trailing whitespaces not count
+        pStr = paramStr;
+        keyEnd = paramStr;
+        hash = __keyHashInit;
+        keyHash = hash;
+        while (*pStr != '\0' && *pStr != PARAM_KEY_SEPARATOR) {
+            hash = __keyHashStep(hash, *pStr);
+            if (!__isWhitespace(*pStr)) {
+                keyHash = hash;
+                keyEnd = pStr + 1;
+            }
+            pStr++;
+        }
+        if (*pStr == PARAM_KEY_SEPARATOR) {
+            *keyEnd = '\0';
+            pStr++;
+            while (__isWhitespace(*pStr)) {
+                pStr++;
+            }
+            param->Key = paramStr;
+            param->Hash = keyHash;
+            param->Str = pStr;
+            param->Len = len - (Str_LenType)(pStr - paramStr);
+        }
+        else {
+            param->Key = NULL;
+            param->Hash = 0;
+            param->Str = paramStr;
+            param->Len = len;
+        }
+        param->Param.Index = cursor->Index++;
+        param->Parsed = !keyValues->Lazy;
+        if (param->Parsed) {
+            Param_parseToken(param->Str, param->Len, &param->Param.Value);
+        }
+        // index key
+        if (param->Key != NULL) {
+            slot = Param_findKeySlot(keyValues, param->Key, param->Hash);
+            if (*slot < 0) {
+                *slot = keyValues->Len;
+            }
+        }
+        keyValues->Len++;
+    }
+    // params are full, check line has more params same as Param_next
+    keyValues->Truncated = keyValues->Len == keyValues->Size &&
+        cursor->Ptr != NULL && (*cursor->Ptr != '\0' || cursor->Len != 0);
+
+    return keyValues->Len;
+}
+/**
+ * @brief find param by key, in lazy mode value is converted here
+ *
+ * @param keyValues
+ * @param key
+ * @return Param* param, or NULL if key not found
+ */
+Param* Param_find(Param_KeyValues* keyValues, const char* key) {
+    Param_KeyValue* param;
+    Param_LenType* slot;
+    const char* pKey = key;
+    uint32_t hash = __keyHashInit;
+
+    while (*pKey != '\0') {
+        hash = __keyHashStep(hash, *pKey);
+        pKey++;
+    }
+    slot = Param_findKeySlot(keyValues, key, hash);
+    if (*slot < 0) {
+        return NULL;
+    }
+    param = &keyValues->Params[*slot];
+    if (!param->Parsed) {
+        Param_parseToken(param->Str, param->Len, &param->Param.Value);
+        param->Parsed = 1;
+    }
+    return &param->Param;
+}
+/**
+ * @brief parse next param without modify the buffer, cursor must initialized with Param_initCursorView
+ * String, Null and Unknown params returned as views (ptr, len) into the buffer
+ *
+ * @param cursor
+ * @param param
+ * @return Param* return param, or NULL if there is no more params
+ */
+Param* Param_nextView(Param_Cursor* cursor, Param* param) {
+    const char* pStr = cursor->Ptr;
+    const char* pEnd;
+    const char* end;
+    // check cursor is valid
+    if (cursor->Ptr == NULL || cursor->Len <= 0) {
+        return NULL;
+    }
+    end = pStr + cursor->Len;
+    // ignore whitspaces
+    while (pStr < end && __isWhitespace(*pStr)) {
+        pStr++;
+    }
+    // find end of param
+    pEnd = Param_scan(pStr, end, cursor->ParamSeparator, cursor->ParamSeparator);
+    __PARAM_STATS_ADD(Bytes, (uint64_t)(pEnd - cursor->Ptr) + (pEnd < end));
+    if (pEnd < end) {
+        cursor->Ptr = (char*) pEnd + 1;
+        cursor->Len = (Str_LenType)(end - pEnd - 1);
+    }
+    else {
+        cursor->Ptr = NULL;
+        cursor->Len = 0;
+    }
+    // trim right
+    while (pEnd > pStr && __isWhitespace(*(pEnd - 1))) {
+        pEnd--;
+    }
+    // find value type base on first character
+    Param_parseView(pStr, (Str_LenType)(pEnd - pStr), &param->Value);
+    // return param
+    param->Index = cursor->Index++;
+    return param;
+}
+/**
+ * @brief find boundaries of params in one scan without convert them, line not modified
+ * use Param_get to parse only params that needed, params are same as Param_nextView return
+ *
+ * @param index
+ * @param line
+ * @param len length of line
+ * @param paramSeparator ex: ','
+ * @param offsets array for start of params
+ * @param size size of offsets, rest of line not indexed if there is more params
+ * @return Param_LenType number of indexed params
+ */
+Param_LenType Param_index(Param_Index* index, const char* line, Str_LenType len, char paramSeparator, Str_LenType* offsets, Param_LenType size) {
+    const char* pStr = line;
+    const char* pEnd = line;
+    const char* end = line + (len > 0 ? len : 0);
+    Param_LenType count = 0;
+
+    while (pStr < end && count < size) {
+        offsets[count++] = (Str_LenType)(pStr - line);
+        pEnd = Param_scan(pStr, end, paramSeparator, paramSeparator);
+        pStr = pEnd + 1;
+    }
+    __PARAM_STATS_ADD(Bytes, (uint64_t)(pEnd - line));
+    index->Ptr = line;
+    index->Offsets = offsets;
+    index->End = (Str_LenType)(pEnd - line);
+    index->Len = count;
+    return count;
+}
+/**
+ * @brief parse param k of index in view mode, String, Null and Unknown values returned as views
+ *
+ * @param index
+ * @param k index of param
+ * @param value
+ * @return Param_Result Param_Error if k is not indexed
+ */
+Param_Result Param_get(const Param_Index* index, Param_LenType k, Param_Value* value) {
+    const char* pStr;
+    const char* pEnd;
+
+    if (k < 0 || k >= index->Len) {
+        return Param_Error;
+    }
+    pStr = index->Ptr + index->Offsets[k];
+    pEnd = index->Ptr + (k + 1 < index->Len ? index->Offsets[k + 1] - 1 : index->End);
+    // trim both sides
+    while (pStr < pEnd && __isWhitespace(*pStr)) {
+        pStr++;
+    }
+    while (pEnd > pStr && __isWhitespace(*(pEnd - 1))) {
+        pEnd--;
+    }
+    Param_parseView(pStr, (Str_LenType)(pEnd - pStr), value);
+    return Param_Ok;
+}
+/**
+ * @brief initialize stream cursor, buffer only keep the param that split between chunks
+ *
+ * @param stream
+ * @param buffer
+ * @param size size of buffer, maximum length of split param
+ * @param paramSeparator
+ * @param lineEnd end of line character, ex: '\n'
+ * @param onParam call for each param
+ */
+void Param_initStream(Param_Stream* stream, char* buffer, Str_LenType size, char paramSeparator, char lineEnd, Param_StreamFn onParam) {
+    stream->OnParam = onParam;
+    stream->Args = NULL;
+    stream->Buffer = buffer;
+    stream->Size = size;
+    stream->Len = 0;
+    stream->Index = 0;
+    stream->ParamSeparator = paramSeparator;
+    stream->LineEnd = lineEnd;
+    stream->Overflow = 0;
+    stream->Pending = 0;
+}
+/**
+ * @brief append part of unfinished param to stream buffer, leading whitespaces are not stored
+ *
+ * @param stream
+ * @param str
+ * @param len
+ */
+static void Param_streamKeep(Param_Stream* stream, const char* str, Str_LenType len) {
+    if (len > 0) {
+        stream->Pending = 1;
+    }
+    if (stream->Len == 0) {
+        while (len > 0 && __isWhitespace(*str)) {
+            str++;
+            len--;
+        }
+    }
+    if (len > stream->Size - stream->Len) {
+        len = stream->Size - stream->Len;
+        stream->Overflow = 1;
+    }
+    memcpy(&stream->Buffer[stream->Len], str, len);
+    stream->Len += len;
+}
+/**
+ * @brief parse finished param and pass it to callback, last param of a line is ignored only when
+ * line end right after separator, same as Param_next, ex: "a," has one param but "a, " has two
+ *
+ * @param stream
+ * @param str
+ * @param len length of param before trim
+ * @param lineEnd param finished by end of line
+ * @return Param_Result Param_Error if param is longer than buffer, it's dropped but Index still counted
+ */
+static Param_Result Param_streamEmit(Param_Stream* stream, const char* str, Str_LenType len, char lineEnd) {
+    Param param;
+    Param_Result res = Param_Ok;
+    const char* pEnd = str + len;
+
+    while (str < pEnd && __isWhitespace(*str)) {
+        str++;
+    }
+    while (pEnd > str && __isWhitespace(*(pEnd - 1))) {
+        pEnd--;
+    }
+    if (stream->Overflow) {
+        stream->Overflow = 0;
+        res = Param_Error;
+        stream->Index++;
+    }
+    else if (!lineEnd || len != 0 || stream->Pending) {
+        Param_parseView(str, (Str_LenType)(pEnd - str), &param.Value);
+        param.Index = stream->Index++;
+        stream->OnParam(stream, &param);
+    }
+    stream->Len = 0;
+    stream->Pending = 0;
+    if (lineEnd) {
+        stream->Index = 0;
+    }
+    return res;
+}
+/**
+ * @brief feed a chunk of input to stream, each param pass to callback as soon as its separator received,
+ * params that finish inside of chunk parse in place, only unfinished param copy to stream buffer
+ *
+ * @param stream
+ * @param chunk
+ * @param len
+ * @return Param_Result Param_Error if a param was longer than stream buffer
+ */
+Param_Result Param_feed(Param_Stream* stream, const char* chunk, Str_LenType len) {
+    const char* end = chunk + len;
+    const char* pStr;
+    const char* pEnd;
+    Str_LenType paramLen;
+    Param_Result res = Param_Ok;
+
+    while (chunk < end) {
+        pEnd = Param_scan(chunk, end, stream->ParamSeparator, stream->LineEnd);
+        if (pEnd == end) {
+            Param_streamKeep(stream, chunk, (Str_LenType)(end - chunk));
+            break;
+        }
+        if (stream->Len == 0 && !stream->Overflow) {
+            // whole param is inside of chunk
+            pStr = chunk;
+            paramLen = (Str_LenType)(pEnd - chunk);
+        }
+        else {
+            Param_streamKeep(stream, chunk, (Str_LenType)(pEnd - chunk));
+            pStr = stream->Buffer;
+            paramLen = stream->Len;
+        }
+        if (Param_streamEmit(stream, pStr, paramLen, *pEnd == stream->LineEnd) != Param_Ok) {
+            res = Param_Error;
+        }
+        chunk = pEnd + 1;
+    }
+
+    return res;
+}
+/**
+ * @brief finish unfinished param at end of input same as end of line
+ *
+ * @param stream
+ * @return Param_Result Param_Error if param was longer than stream buffer
+ */
+Param_Result Param_flush(Param_Stream* stream) {
+    return Param_streamEmit(stream, stream->Buffer, stream->Len, 1);
+}
+/**
+ * @brief find first character that equal to c1 or c2 in range [str, end)
+ * it never read bytes out of given range, use same character for c1 and c2 to find one character
+ *
+ * @param str start of range
+ * @param end end of range
+ * @param c1 first character
+ * @param c2 second character
+ * @return const char* pointer to first match, or end if not found
+ */
+const char* Param_scan(const char* str, const char* end, char c1, char c2) {
+#if PARAM_SIMD == PARAM_SIMD_AVX2
+    {
+        const __m256i v1 = _mm256_set1_epi8(c1);
+        const __m256i v2 = _mm256_set1_epi8(c2);
+        while (end - str >= 32) {
+            __m256i chunk = _mm256_loadu_si256((const __m256i*) str);
+            uint32_t mask = (uint32_t) _mm256_movemask_epi8(
+                _mm256_or_si256(_mm256_cmpeq_epi8(chunk, v1), _mm256_cmpeq_epi8(chunk, v2)));
+            if (mask != 0) {
+                return str + PARAM_CTZ32(mask);
+            }
+            str += 32;
+        }
+    }
+#endif
+#if PARAM_SIMD == PARAM_SIMD_AVX2 || PARAM_SIMD == PARAM_SIMD_SSE2
+    {
+        const __m128i v1 = _mm_set1_epi8(c1);
+        const __m128i v2 = _mm_set1_epi8(c2);
+        while (end - str >= 16) {
+            __m128i chunk = _mm_loadu_si128((const __m128i*) str);
+            uint32_t mask = (uint32_t) _mm_movemask_epi8(
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, v1), _mm_cmpeq_epi8(chunk, v2)));
+            if (mask != 0) {
+                return str + PARAM_CTZ32(mask);
+            }
+            str += 16;
+        }
+    }
+#elif PARAM_SIMD == PARAM_SIMD_NEON
+    {
+        const uint8x16_t v1 = vdupq_n_u8((uint8_t) c1);
+        const uint8x16_t v2 = vdupq_n_u8((uint8_t) c2);
+        while (end - str >= 16) {
+            uint8x16_t chunk = vld1q_u8((const uint8_t*) str);
+            uint8x16_t eq = vorrq_u8(vceqq_u8(chunk, v1), vceqq_u8(chunk, v2));
+            // narrow each byte to a nibble, so first match is ctz / 4
+            uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+            if (mask != 0) {
+                return str + (PARAM_CTZ64(mask) >> 2);
+            }
+            str += 16;
+        }
+    }
+#endif
+#if PARAM_SCAN_MODE != PARAM_SCAN_BYTE
+    {
+        // SWAR, 8 bytes per step
+        const uint64_t ones = 0x0101010101010101ULL;
+        const uint64_t highs = 0x8080808080808080ULL;
+        const uint64_t p1 = ones * (uint8_t) c1;
+        const uint64_t p2 = ones * (uint8_t) c2;
+        while (end - str >= 8) {
+            uint64_t word;
+            uint64_t x1, x2, mask;
+            memcpy(&word, str, sizeof(word));
+            x1 = word ^ p1;
+            x2 = word ^ p2;
+            mask = ((x1 - ones) & ~x1 & highs) | ((x2 - ones) & ~x2 & highs);
+            if (mask != 0) {
+            #if PARAM_SYSTEM_BYTE_ORDER == PARAM_SYSTEM_BYTE_ORDER_LE
+                // borrow only can make false hits after the first real match
+                return str + (PARAM_CTZ64(mask) >> 3);
+            #else
+                break;
+            #endif
+            }
+            str += 8;
+        }
+    }
+#endif
+    while (str < end && *str != c1 && *str != c2) {
+        str++;
+    }
+    return str;
+}
+/**
+ * @brief Parse a string into param object
+ * 
+ * @param str 
+ * @param param 
+ * @return Param_Result 
+ */
+Param_Result Param_parse(char* str, Param_Value* param) {
+    return Param_parseToken(str, -1, param);
+}
+/**
+ * @brief Parse a param string with known length, length is -1 if it's unknown
+ *
+ * @param str null terminated param
+ * @param len length of param or -1
+ * @param param
+ * @return Param_Result
+ */
+static Param_Result Param_parseToken(char* str, Str_LenType len, Param_Value* param) {
+    Param_Result res = Param_Error;
+    __PARAM_STATS_BEGIN();
+
+    switch (*str) {
+    #if PARAM_TYPE_NUMBER
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+        case '-':
+            // check for number or its float
+            res = Param_parseNumberToken(str, len < 0 ? Str_len(str) : len, param);
+            break;
+    #endif // PARAM_TYPE_NUMBER
+    #if PARAM_TYPE_STRING
+        case '"':
+            // string
+            res = Param_parseString(str, param);
+            break;
+    #endif // PARAM_TYPE_STRING
+    #if __PARAM_TYPE_KEYWORD || PARAM_TYPE_ENUM || __PARAM_TYPE_NON_FINITE
+        default:
+        #if PARAM_TYPE_ENUM
+            // registered names first, they can reuse keywords
+            res = Param_parseEnum(str, len < 0 ? Str_len(str) : len, param);
+        #endif
+        #if __PARAM_TYPE_KEYWORD
+            if (res != Param_Ok) {
+                // true, false, high, low, on, off, null
+                res = Param_parseKeyword(str, len < 0 ? Param_keywordLen(str) : len, param);
+            }
+        #endif
+        #if __PARAM_TYPE_NON_FINITE
+            if (res != Param_Ok) {
+                // Inf, NaN
+                res = Param_parseNonFinite(str, len < 0 ? Str_len(str) : len, param);
+            }
+        #endif
+            break;
+    #endif // __PARAM_TYPE_KEYWORD || PARAM_TYPE_ENUM || __PARAM_TYPE_NON_FINITE
+    }
+
+    // check if param is not valid
+    if (res != Param_Ok) {
+        Param_parseUnknown(str, param);
+    }
+    __PARAM_STATS_TOKEN(param, res);
+
+    return res;
+}
+#if PARAM_TYPE_NUMBER_BINARY || PARAM_TYPE_NUMBER_HEX
+/**
+ * @brief parse digits of power of 2 radix numbers
+ *
+ * @param str first digit
+ * @param len number of digits
+ * @param shift bits per digit, 1 for binary, 4 for hex
+ * @param value
+ * @return Param_Result
+ */
+static Param_Result Param_parseRadix(const char* str, Str_LenType len, uint8_t shift, Param_UNumber* value) {
+    Param_UNumber num = 0;
+    uint8_t digit;
+
+    if (len <= 0) {
+        return Param_Error;
+    }
+    while (len-- > 0) {
+        digit = (uint8_t)(*str++ - '0');
+        if (digit > 9) {
+            // a-f, A-F
+            digit = (uint8_t)(((digit + '0') | 0x20) - 'a' + 10);
+            if (digit < 10 || digit > 15) {
+                return Param_Error;
+            }
+        }
+        if ((digit >> shift) != 0 || (num >> (sizeof(num) * 8 - shift)) != 0) {
+            return Param_Error;
+        }
+        num = (num << shift) | digit;
+    }
+    *value = num;
+    return Param_Ok;
+}
+#endif // PARAM_TYPE_NUMBER_BINARY || PARAM_TYPE_NUMBER_HEX
+#if PARAM_TYPE_NUMBER_BINARY
+/**
+ * @brief parse binary strings
+ * ex: "0b1010" -> 0xA
+ *
+ * @param cursor
+ * @param param
+ * @return Param_Result
+ */
+Param_Result Param_parseBinary(char* str, Param_Value* param) {
+    param->Type = Param_ValueType_NumberBinary;
+    return Param_parseRadix(str + 2, Str_len(str) - 2, 1, &param->NumberBinary);
+}
+#endif // PARAM_TYPE_NUMBER_BINARY
+#if PARAM_TYPE_NUMBER_HEX
+/**
+ * @brief parse hex strings
+ * ex: "0xA" -> 0xA
+ *
+ * @param cursor
+ * @param param
+ * @return Param_Result
+ */
+Param_Result Param_parseHex(char* str, Param_Value* param) {
+    param->Type = Param_ValueType_NumberHex;
+    return Param_parseRadix(str + 2, Str_len(str) - 2, 4, &param->NumberHex);
+}
+#endif // PARAM_TYPE_NUMBER_HEX
+#if PARAM_TYPE_NUMBER
+/**
+ * @brief decode type suffix of numbers, ex: u8, i32, f64
+ *
+ * @param str start of suffix
+ * @param len length of suffix
+ * @return int16_t value type, or -1 if suffix is not valid, Param_ValueType_Unknown if there is no suffix
+ */
+static int16_t Param_parseNumberSuffix(const char* str, Str_LenType len) {
+    uint8_t bits;
+
+    if (len == 0) {
+        return Param_ValueType_Unknown;
+    }
+    else if (len == 1) {
+        bits = 0;
+    }
+    else if (len == 2 && str[1] == '8') {
+        bits = 8;
+    }
+    else if (len == 3 && str[1] == '1' && str[2] == '6') {
+        bits = 16;
+    }
+    else if (len == 3 && str[1] == '3' && str[2] == '2') {
+        bits = 32;
+    }
+#if PARAM_TYPE_64BIT
+    else if (len == 3 && str[1] == '6' && str[2] == '4') {
+        bits = 64;
+    }
+#endif
+    else {
+        return -1;
+    }
+
+    switch (*str) {
+        case 'u':
+            switch (bits) {
+                case 0:     return Param_ValueType_UNumber;
+                case 8:     return Param_ValueType_UInt8;
+                case 16:    return Param_ValueType_UInt16;
+                case 32:    return Param_ValueType_UInt32;
+            #if PARAM_TYPE_64BIT
+                case 64:    return Param_ValueType_UInt64;
+            #endif
+            }
+            break;
+        case 'i':
+            switch (bits) {
+                case 0:     return Param_ValueType_Number;
+                case 8:     return Param_ValueType_Int8;
+                case 16:    return Param_ValueType_Int16;
+                case 32:    return Param_ValueType_Int32;
+            #if PARAM_TYPE_64BIT
+                case 64:    return Param_ValueType_Int64;
+            #endif
+            }
+            break;
+        case 'f':
+            switch (bits) {
+                case 0:
+                case 32:    return Param_ValueType_Float;
+            #if PARAM_TYPE_64BIT
+                case 64:    return Param_ValueType_Double;
+            #endif
+            }
+            break;
+    }
+    return -1;
+}
+/**
+ * @brief convert scanned decimal into float or double
+ *
+ * @param dec
+ * @param param type of param must be set before
+ * @return Param_Result
+ */
+static Param_Result Param_convertDecimal(const Param_Decimal* dec, Param_Value* param) {
+#if PARAM_FLOAT_PARSER == PARAM_FLOAT_PARSER_EXACT
+#if PARAM_TYPE_64BIT
+    if (param->Type == Param_ValueType_Double) {
+        param->Double = Param_decimalToDouble(dec);
+        return Param_Ok;
+    }
+#endif
+    param->Float = Param_decimalToFloat(dec);
+    return Param_Ok;
+#else
+    static const float POW10_FLOAT[] = {
+        1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f,
+    };
+#if PARAM_TYPE_64BIT
+    static const double POW10_DOUBLE[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+    };
+#endif
+    char num[PARAM_VIEW_NUMBER_LEN];
+
+#if PARAM_TYPE_64BIT
+    if (param->Type == Param_ValueType_Double) {
+        // Clinger fast path, both operands are exact so result rounded once
+        if (!dec->Truncated && dec->Mantissa <= (1ULL << 53) && dec->Exponent >= -22 && dec->Exponent <= 22) {
+            double value = (double) dec->Mantissa;
+            value = dec->Exponent < 0 ? value / POW10_DOUBLE[-dec->Exponent] : value * POW10_DOUBLE[dec->Exponent];
+            param->Double = dec->Negative ? -value : value;
+            return Param_Ok;
+        }
+    }
+    else
+#endif
+    {
+        if (!dec->Truncated && dec->Mantissa <= (1UL << 24) && dec->Exponent >= -10 && dec->Exponent <= 10) {
+            float value = (float) dec->Mantissa;
+            value = dec->Exponent < 0 ? value / POW10_FLOAT[-dec->Exponent] : value * POW10_FLOAT[dec->Exponent];
+            param->Float = dec->Negative ? -value : value;
+            return Param_Ok;
+        }
+    }
+    // slow path
+    if (dec->Len + 1 >= PARAM_VIEW_NUMBER_LEN) {
+        return Param_Error;
+    }
+    num[0] = '-';
+    memcpy(&num[1], dec->Str, dec->Len);
+    num[dec->Len + 1] = '\0';
+#if PARAM_TYPE_64BIT
+    if (param->Type == Param_ValueType_Double) {
+        return (Param_Result) Str_convertDouble(&num[!dec->Negative], &param->Double);
+    }
+#endif
+    return (Param_Result) Str_convertFloat(&num[!dec->Negative], &param->Float);
+#endif // PARAM_FLOAT_PARSER
+}
+/**
+ * @brief scan decimal number in single pass, digits, decimal point and exponent
+ *
+ * @param str start of number
+ * @param end end of number
+ * @param dec scanned number
+ * @param isFloat set if number has decimal point or exponent
+ * @return const char* start of suffix, or NULL if number is not valid
+ */
+static const char* Param_scanDecimal(const char* str, const char* end, Param_Decimal* dec, uint8_t* isFloat) {
+    const char* pStr = str;
+    const char* digitsStart;
+    uint8_t digits = 0;
+    uint8_t digit;
+
+    *isFloat = 0;
+    dec->Mantissa = 0;
+    dec->Exponent = 0;
+    dec->Truncated = 0;
+    dec->Negative = pStr < end && *pStr == '-';
+    pStr += dec->Negative;
+    dec->Str = pStr;
+    digitsStart = pStr;
+    // integer part
+    while (pStr < end && (digit = (uint8_t)(*pStr - '0')) < 10) {
+        if (dec->Mantissa <= (UINT64_MAX - digit) / 10) {
+            dec->Mantissa = dec->Mantissa * 10 + digit;
+        }
+        else {
+            // keep significant digits, drop the rest
+            dec->Exponent++;
+            dec->Truncated |= digit != 0;
+        }
+        pStr++;
+    }
+    digits = pStr != digitsStart;
+    // fraction part
+    if (pStr < end && *pStr == '.') {
+        *isFloat = 1;
+        pStr++;
+        while (pStr < end && (digit = (uint8_t)(*pStr - '0')) < 10) {
+            if (dec->Mantissa <= (UINT64_MAX - digit) / 10) {
+                dec->Mantissa = dec->Mantissa * 10 + digit;
+                dec->Exponent--;
+            }
+            else {
+                dec->Truncated |= digit != 0;
+            }
+            digits = 1;
+            pStr++;
+        }
+    }
+    if (!digits) {
+        return NULL;
+    }
+    // exponent part
+    if (pStr < end && (*pStr == 'e' || *pStr == 'E')) {
+        int32_t exp = 0;
+        uint8_t expNegative = 0;
+        *isFloat = 1;
+        pStr++;
+        if (pStr < end && (*pStr == '-' || *pStr == '+')) {
+            expNegative = *pStr++ == '-';
+        }
+        digitsStart = pStr;
+        while (pStr < end && (digit = (uint8_t)(*pStr - '0')) < 10) {
+            if (exp < 100000) {
+                exp = exp * 10 + digit;
+            }
+            pStr++;
+        }
+        if (pStr == digitsStart) {
+            return NULL;
+        }
+        dec->Exponent += expNegative ? -exp : exp;
+    }
+    dec->Len = (Str_LenType)(pStr - dec->Str);
+    return pStr;
+}
+#if __PARAM_TYPE_NON_FINITE
+/**
+ * @brief compare str with word of PARAM_DEFAULT_INF or PARAM_DEFAULT_NAN, exact word of Param_valueToStr
+ * always match and other forms are case folded base on PARAM_CASE_MODE same as keywords
+ *
+ * @param str
+ * @param word letters only
+ * @param len length of word, str must have at least len characters
+ * @return uint8_t 1 if match
+ */
+static uint8_t Param_matchNonFinite(const char* str, const char* word, Str_LenType len) {
+    Str_LenType i;
+
+    if (memcmp(str, word, len) == 0) {
+        return 1;
+    }
+    for (i = 0; i < len; i++) {
+    #if PARAM_CASE_MODE == PARAM_CASE_INSENSITIVE
+        if ((str[i] | 0x20) != (word[i] | 0x20)) {
+    #elif PARAM_CASE_MODE == PARAM_CASE_HIGHER
+        if (str[i] != (word[i] & ~0x20)) {
     #else
-        Str_compare(str, "high") == 0
+        if (str[i] != (word[i] | 0x20)) {
     #endif
+            return 0;
+        }
+    }
+    return 1;
+}
+/**
+ * @brief parse infinite and NaN in format of Param_valueToStr, suffix select float or double,
+ * words case folded base on PARAM_CASE_MODE
+ * ex: "Inf", "-Inf", "NaN", "-Inff64", "inf", "NAN"
+ *
+ * @param str
+ * @param len
+ * @param param
+ * @return Param_Result
+ */
+static Param_Result Param_parseNonFinite(const char* str, Str_LenType len, Param_Value* param) {
+    uint8_t negative = 0;
+    uint8_t isNaN;
+    int16_t type;
+    uint32_t bits32;
+#if PARAM_TYPE_64BIT
+    uint64_t bits64;
+#endif
+
+    if (len > 0 && *str == '-') {
+        negative = 1;
+        str++;
+        len--;
+    }
+    if (len >= (Str_LenType)(sizeof(PARAM_DEFAULT_INF) - 1) &&
+        Param_matchNonFinite(str, PARAM_DEFAULT_INF, (Str_LenType)(sizeof(PARAM_DEFAULT_INF) - 1))
     ) {
-        param->State = 1;
-        return Param_Ok;
+        isNaN = 0;
+        str += sizeof(PARAM_DEFAULT_INF) - 1;
+        len -= (Str_LenType)(sizeof(PARAM_DEFAULT_INF) - 1);
     }
-    else if (
-    #if PARAM_CASE_MODE == PARAM_CASE_LOWER
-        Str_compare(str, "low") == 0
-    #elif PARAM_CASE_MODE == PARAM_CASE_HIGHER
-        Str_compare(str, "LOW") == 0
-    #else
-        Str_compare(str, "low") == 0
-    #endif
+    else if (!negative && len >= (Str_LenType)(sizeof(PARAM_DEFAULT_NAN) - 1) &&
+        Param_matchNonFinite(str, PARAM_DEFAULT_NAN, (Str_LenType)(sizeof(PARAM_DEFAULT_NAN) - 1))
     ) {
-        param->State = 0;
-        return Param_Ok;
+        isNaN = 1;
+        str += sizeof(PARAM_DEFAULT_NAN) - 1;
+        len -= (Str_LenType)(sizeof(PARAM_DEFAULT_NAN) - 1);
     }
     else {
         return Param_Error;
     }
+    type = Param_parseNumberSuffix(str, len);
+    if (type == Param_ValueType_Unknown || type == Param_ValueType_Float) {
+        bits32 = isNaN ? 0x7FC00000 : (0x7F800000 | ((uint32_t) negative << 31));
+        param->Type = Param_ValueType_Float;
+        memcpy(&param->Float, &bits32, sizeof(bits32));
+        return Param_Ok;
+    }
+#if PARAM_TYPE_64BIT
+    else if (type == Param_ValueType_Double) {
+        bits64 = isNaN ? 0x7FF8000000000000ULL : (0x7FF0000000000000ULL | ((uint64_t) negative << 63));
+        param->Type = Param_ValueType_Double;
+        memcpy(&param->Double, &bits64, sizeof(bits64));
+        return Param_Ok;
+    }
+#endif
+    return Param_Error;
 }
-#endif // PARAM_TYPE_STATE
-#if PARAM_TYPE_STATE_KEY
+#endif // __PARAM_TYPE_NON_FINITE
 /**
- * @brief parse state key strings
- * ex: "on" -> 1 or "off" -> 0
+ * @brief parse decimal numbers in single pass, digits, decimal point, exponent and suffix
+ * ex: "-12", "12u8", "2.5", "2.5e3", "2.5f64"
  *
- * @param cursor
+ * @param str start of number
+ * @param len length of number
  * @param param
  * @return Param_Result
  */
-Param_Result Param_parseStateKey(char* str, Param_Value* param) {
-    __convert(str);
-    if (
-    #if PARAM_CASE_MODE == PARAM_CASE_LOWER
-        Str_compare(str, "on") == 0
-    #elif PARAM_CASE_MODE == PARAM_CASE_HIGHER
-        Str_compare(str, "ON") == 0
+static Param_Result Param_parseNumber(const char* str, Str_LenType len, Param_Value* param) {
+    const char* end = str + len;
+    const char* pStr;
+    Param_Decimal dec;
+    int16_t type;
+    uint8_t isFloat;
+
+    pStr = Param_scanDecimal(str, end, &dec, &isFloat);
+    if (pStr == NULL) {
+    #if __PARAM_TYPE_NON_FINITE
+        // "-Inf"
+        return Param_parseNonFinite(str, len, param);
     #else
-        Str_compare(str, "on") == 0
+        return Param_Error;
     #endif
-    ) {
-        param->Type = Param_ValueType_StateKey;
-        param->StateKey = 1;
+    }
+    // suffix
+    type = Param_parseNumberSuffix(pStr, (Str_LenType)(end - pStr));
+    if (type < 0) {
+        return Param_Error;
+    }
+#if PARAM_STATS
+    if (type != Param_ValueType_Unknown) {
+        __PARAM_STATS_ADD(Suffix, 1);
+    }
+#endif
+    param->Type = (Param_ValueType) type;
+
+#if PARAM_TYPE_64BIT
+    if (type == Param_ValueType_Double) {
+        return Param_convertDecimal(&dec, param);
+    }
+    else
+#endif
+    if (type == Param_ValueType_Float || isFloat) {
+        // it's float
+        param->Type = Param_ValueType_Float;
+        return Param_convertDecimal(&dec, param);
+    }
+    else {
+        // it's number
+        Param_UNumber limit = (Param_UNumber) ~((Param_UNumber) 0) >> 1;
+        if (type == Param_ValueType_Unknown) {
+            param->Type = Param_ValueType_Number;
+        }
+        if (dec.Negative) {
+            limit += 1;
+        }
+        else if (type == Param_ValueType_UNumber || type == Param_ValueType_UInt8 ||
+            type == Param_ValueType_UInt16 || type == Param_ValueType_UInt32
+        #if PARAM_TYPE_64BIT
+            || type == Param_ValueType_UInt64
+        #endif
+        ) {
+            limit = (Param_UNumber) ~((Param_UNumber) 0);
+        }
+        if (dec.Truncated || dec.Exponent != 0 || dec.Mantissa > limit) {
+            return Param_Error;
+        }
+        param->UNumber = dec.Negative ? (Param_UNumber) 0 - (Param_UNumber) dec.Mantissa : (Param_UNumber) dec.Mantissa;
         return Param_Ok;
     }
-    else if (
-    #if PARAM_CASE_MODE == PARAM_CASE_LOWER
-        Str_compare(str, "off") == 0
-    #elif PARAM_CASE_MODE == PARAM_CASE_HIGHER
-        Str_compare(str, "OFF") == 0
-    #else
-        Str_compare(str, "off") == 0
-    #endif
-    ) {
-        param->Type = Param_ValueType_StateKey;
-        param->StateKey = 0;
+}
+/**
+ * @brief parse numbers that start with digit or '-', check for hex and binary prefix
+ *
+ * @param str
+ * @param len
+ * @param param
+ * @return Param_Result
+ */
+static Param_Result Param_parseNumberToken(const char* str, Str_LenType len, Param_Value* param) {
+#if PARAM_TYPE_NUMBER_BINARY || PARAM_TYPE_NUMBER_HEX
+    if (len > 2 && *str == '0') {
+        switch (*(str + 1)) {
+        #if PARAM_TYPE_NUMBER_BINARY
+            case 'b':
+            case 'B':
+                // binary num
+                param->Type = Param_ValueType_NumberBinary;
+                if (Param_parseRadix(str + 2, len - 2, 1, &param->NumberBinary) == Param_Ok) {
+                    return Param_Ok;
+                }
+                break;
+        #endif // PARAM_TYPE_NUMBER_BINARY
+        #if PARAM_TYPE_NUMBER_HEX
+            case 'x':
+            case 'X':
+                // hex num
+                param->Type = Param_ValueType_NumberHex;
+                if (Param_parseRadix(str + 2, len - 2, 4, &param->NumberHex) == Param_Ok) {
+                    return Param_Ok;
+                }
+                break;
+        #endif // PARAM_TYPE_NUMBER_HEX
+        }
+    }
+#endif // PARAM_TYPE_NUMBER_BINARY || PARAM_TYPE_NUMBER_HEX
+    return Param_parseNumber(str, len, param);
+}
+/**
+ * @brief parse number strings
+ * ex: "123" -> 123
+ *
+ * @param cursor
+ * @param param
+ * @return Param_Result
+ */
+Param_Result Param_parseNum(char* str, Param_Value* param) {
+    return Param_parseNumber(str, Str_len(str), param);
+}
+#endif // PARAM_TYPE_NUMBER
+#if PARAM_TYPE_STRING
+/**
+ * @brief parse strings
+ * ex: "\"Text\"" -> "Text"
+ *
+ * @param cursor
+ * @param param
+ * @return Param_Result
+ */
+Param_Result Param_parseString(char* str, Param_Value* param) {
+    Str_LenType len = Str_fromString(str);
+    if (len != -1) {
+        param->Type = Param_ValueType_String;
+        param->String = str;
         return Param_Ok;
     }
     else {
         return Param_Error;
     }
 }
-#endif // PARAM_TYPE_STATE_KEY
-#if PARAM_TYPE_BOOLEAN
+#endif // PARAM_TYPE_STRING
+#if __PARAM_TYPE_KEYWORD
+#define PARAM_KEYWORD_MAX_LEN           5
+
+#if PARAM_CASE_MODE == PARAM_CASE_HIGHER
+    #define __keywordChar(C)            ((uint64_t)((C) & ~0x20))
+#else
+    #define __keywordChar(C)            ((uint64_t)(C))
+#endif
+
+#define __keyword(A, B, C, D, E)        (__keywordChar(A) | (__keywordChar(B) << 8) | (__keywordChar(C) << 16) | \
+                                        (__keywordChar(D) << 24) | (__keywordChar(E) << 32))
 /**
- * @brief parse boolean strings
- * ex: "true" -> true or "false" -> false
+ * @brief slot of keyword, unique for all keywords, first character folded to lower case
+ */
+#define __keywordHash(C, LEN)           ((((C) | 0x20) + (LEN) * 5) & 7)
+/**
+ * @brief keywords in slot of __keywordHash
+ */
+static const Param_Keyword PARAM_KEYWORDS[8] = {
+    { __keyword('t', 'r', 'u', 'e', 0),     PARAM_TYPE_BOOLEAN ? 4 : 0,     Param_ValueType_Boolean,    1 },
+    { __keyword('o', 'n', 0, 0, 0),         PARAM_TYPE_STATE_KEY ? 2 : 0,   Param_ValueType_StateKey,   1 },
+    { __keyword('n', 'u', 'l', 'l', 0),     PARAM_TYPE_NULL ? 4 : 0,        Param_ValueType_Null,       0 },
+    { __keyword('l', 'o', 'w', 0, 0),       PARAM_TYPE_STATE ? 3 : 0,       Param_ValueType_State,      0 },
+    { __keyword('h', 'i', 'g', 'h', 0),     PARAM_TYPE_STATE ? 4 : 0,       Param_ValueType_State,      1 },
+    { 0,                                    0,                              Param_ValueType_Unknown,    0 },
+    { __keyword('o', 'f', 'f', 0, 0),       PARAM_TYPE_STATE_KEY ? 3 : 0,   Param_ValueType_StateKey,   0 },
+    { __keyword('f', 'a', 'l', 's', 'e'),   PARAM_TYPE_BOOLEAN ? 5 : 0,     Param_ValueType_Boolean,    0 },
+};
+/**
+ * @brief length of null terminated string up to PARAM_KEYWORD_MAX_LEN + 1, longer strings are not keyword
  *
- * @param cursor
+ * @param str
+ * @return Str_LenType
+ */
+static Str_LenType Param_keywordLen(const char* str) {
+    Str_LenType len = 0;
+
+    while (len <= PARAM_KEYWORD_MAX_LEN && str[len] != '\0') {
+        len++;
+    }
+    return len;
+}
+/**
+ * @brief find keyword base on PARAM_CASE_MODE, check length, pick slot and compare whole word at once
+ * string never modified and time is same for any length
+ *
+ * @param str
+ * @param len
+ * @return const Param_Keyword* keyword, or NULL if str is not keyword
+ */
+static const Param_Keyword* Param_findKeyword(const char* str, Str_LenType len) {
+    const Param_Keyword* keyword;
+    uint64_t word = 0;
+
+    if (len < 2 || len > PARAM_KEYWORD_MAX_LEN) {
+        return NULL;
+    }
+    keyword = &PARAM_KEYWORDS[__keywordHash((uint8_t) str[0], len)];
+    if (keyword->Len != len) {
+        return NULL;
+    }
+    switch (len) {
+        case 5:
+            word |= (uint64_t)(uint8_t) str[4] << 32;
+            // fall through
+        case 4:
+            word |= (uint64_t)(uint8_t) str[3] << 24;
+            // fall through
+        case 3:
+            word |= (uint64_t)(uint8_t) str[2] << 16;
+            // fall through
+        default:
+            word |= (uint64_t)(uint8_t) str[1] << 8 | (uint8_t) str[0];
+            break;
+    }
+#if PARAM_CASE_MODE == PARAM_CASE_INSENSITIVE
+    // fold letters to lower case, only inside of keyword length
+    word |= 0x2020202020ULL >> ((PARAM_KEYWORD_MAX_LEN - len) * 8);
+#endif
+    return word == keyword->Word ? keyword : NULL;
+}
+/**
+ * @brief parse keywords, true, false, high, low, on, off and null
+ *
+ * @param str
+ * @param len
  * @param param
  * @return Param_Result
  */
-Param_Result Param_parseBoolean(char* str, Param_Value* param) {
-    __convert(str);
-    if (
-    #if PARAM_CASE_MODE == PARAM_CASE_LOWER
-        Str_compare(str, "true") == 0
-    #elif PARAM_CASE_MODE == PARAM_CASE_HIGHER
-        Str_compare(str, "TRUE") == 0
-    #else
-        Str_compare(str, "true") == 0
-    #endif
-    ) {
-        param->Type = Param_ValueType_Boolean;
-        param->Boolean = 1;
-        return Param_Ok;
+static Param_Result Param_parseKeyword(const char* str, Str_LenType len, Param_Value* param) {
+    const Param_Keyword* keyword = Param_findKeyword(str, len);
+
+    if (keyword == NULL) {
+        return Param_Error;
     }
-    else if (
-    #if PARAM_CASE_MODE == PARAM_CASE_LOWER
-        Str_compare(str, "false") == 0
-    #elif PARAM_CASE_MODE == PARAM_CASE_HIGHER
-        Str_compare(str, "FALSE") == 0
-    #else
-        Str_compare(str, "false") == 0
-    #endif
-    ) {
-        param->Type = Param_ValueType_Boolean;
-        param->Boolean = 0;
-        return Param_Ok;
+    param->Type = (Param_ValueType) keyword->Type;
+    switch (param->Type) {
+        case Param_ValueType_Boolean:
+            param->Boolean = keyword->Value;
+            break;
+        case Param_ValueType_State:
+            param->State = keyword->Value;
+            break;
+        case Param_ValueType_StateKey:
+            param->StateKey = keyword->Value;
+            break;
+        default:
+            param->Null = (char*) str;
+            break;
     }
-    else {
+    return Param_Ok;
+}
+/**
+ * @brief parse keyword of a type
+ *
+ * @param str
+ * @param type
+ * @param param
+ * @return Param_Result
+ */
+static Param_Result Param_parseKeywordType(char* str, Param_ValueType type, Param_Value* param) {
+    Param_Value value;
+
+    if (Param_parseKeyword(str, Param_keywordLen(str), &value) != Param_Ok || value.Type != type) {
+        return Param_Error;
+    }
+    *param = value;
+    return Param_Ok;
+}
+#endif // __PARAM_TYPE_KEYWORD
+#if PARAM_TYPE_ENUM
+/**
+ * @brief enum name in hash table
+ */
+typedef struct {
+    const char*         Name;       /**< NULL for empty slot */
+    uint32_t            Hash;
+    Param_Enum          Value;
+} Param_EnumSlot;
+
+static const Param_EnumTable* Param_EnumTables[PARAM_ENUM_MAX_TABLES];
+static uint8_t Param_EnumTablesLen = 0;
+static Param_EnumSlot Param_EnumSlots[PARAM_ENUM_HASH_SIZE];
+static uint16_t Param_EnumSlotsLen = 0;
+
+#if PARAM_CASE_MODE == PARAM_CASE_INSENSITIVE
+    #define __enumChar(C)               ((uint8_t)((C) >= 'A' && (C) <= 'Z' ? (C) | 0x20 : (C)))
+#else
+    #define __enumChar(C)               ((uint8_t)(C))
+#endif
+/**
+ * @brief FNV-1a hash of name, case folded base on PARAM_CASE_MODE
+ *
+ * @param str
+ * @param len
+ * @return uint32_t
+ */
+static uint32_t Param_enumHash(const char* str, Str_LenType len) {
+    uint32_t hash = 0x811C9DC5UL;
+
+    while (len-- > 0) {
+        hash = (hash ^ __enumChar(*str)) * 0x01000193UL;
+        str++;
+    }
+    return hash;
+}
+/**
+ * @brief find slot of name in hash table
+ *
+ * @param str
+ * @param len
+ * @param hash
+ * @return Param_EnumSlot* slot of name, or empty slot that name can insert in it
+ */
+static Param_EnumSlot* Param_findEnumSlot(const char* str, Str_LenType len, uint32_t hash) {
+    Param_EnumSlot* slot;
+    const char* name;
+    uint16_t index = (uint16_t)(hash & (PARAM_ENUM_HASH_SIZE - 1));
+    Str_LenType i;
+
+    for (;;) {
+        slot = &Param_EnumSlots[index];
+        if (slot->Name == NULL) {
+            return slot;
+        }
+        if (slot->Hash == hash) {
+            name = slot->Name;
+            for (i = 0; i < len && name[i] != '\0' && __enumChar(name[i]) == __enumChar(str[i]); i++) {}
+            if (i == len && name[i] == '\0') {
+                return slot;
+            }
+        }
+        index = (index + 1) & (PARAM_ENUM_HASH_SIZE - 1);
+    }
+}
+/**
+ * @brief register names of an enum type, after that parser return them as Enum values
+ * registered names have priority over built-in keywords (true, on, null, ...), ex: "off" of a mode enum parse as Enum,
+ * Enum has own category so checks of Boolean, State and StateKey not accept it
+ * if a name exists in multiple tables first table wins
+ * tables are shared by all threads, don't register while any thread is parsing
+ * names must not start with digit, '-' or '"'
+ *
+ * @param table
+ * @return int16_t table id, or -1 if there is no space or a name is not valid
+ */
+int16_t Param_registerEnum(const Param_EnumTable* table) {
+    const char* name;
+    Param_EnumSlot* slot;
+    Str_LenType len;
+    uint32_t hash;
+    uint8_t ordinal;
+
+    // keep one empty slot, so search always ends
+    if (Param_EnumTablesLen >= PARAM_ENUM_MAX_TABLES || Param_EnumSlotsLen + table->Len >= PARAM_ENUM_HASH_SIZE) {
+        return -1;
+    }
+    for (ordinal = 0; ordinal < table->Len; ordinal++) {
+        name = table->Names[ordinal];
+        if (name == NULL || *name == '\0' || (*name >= '0' && *name <= '9') || *name == '-' || *name == '"') {
+            return -1;
+        }
+    }
+    for (ordinal = 0; ordinal < table->Len; ordinal++) {
+        name = table->Names[ordinal];
+        len = Str_len(name);
+        hash = Param_enumHash(name, len);
+        slot = Param_findEnumSlot(name, len, hash);
+        if (slot->Name == NULL) {
+            slot->Name = name;
+            slot->Hash = hash;
+            slot->Value.Table = Param_EnumTablesLen;
+            slot->Value.Ordinal = ordinal;
+            Param_EnumSlotsLen++;
+        }
+    }
+    Param_EnumTables[Param_EnumTablesLen] = table;
+    return Param_EnumTablesLen++;
+}
+/**
+ * @brief remove all enum tables, don't call it while any thread is parsing
+ */
+void Param_clearEnums(void) {
+    memset(Param_EnumSlots, 0, sizeof(Param_EnumSlots));
+    Param_EnumSlotsLen = 0;
+    Param_EnumTablesLen = 0;
+}
+/**
+ * @brief return name of enum value
+ *
+ * @param value
+ * @return const char* name, or NULL if value is not valid
+ */
+const char* Param_enumName(Param_Enum value) {
+    if (value.Table >= Param_EnumTablesLen || value.Ordinal >= Param_EnumTables[value.Table]->Len) {
+        return NULL;
+    }
+    return Param_EnumTables[value.Table]->Names[value.Ordinal];
+}
+/**
+ * @brief parse names of registered enums, one hash and one compare
+ *
+ * @param str
+ * @param len
+ * @param param
+ * @return Param_Result
+ */
+static Param_Result Param_parseEnum(const char* str, Str_LenType len, Param_Value* param) {
+    Param_EnumSlot* slot;
+
+    if (Param_EnumSlotsLen == 0 || len <= 0) {
         return Param_Error;
     }
+    slot = Param_findEnumSlot(str, len, Param_enumHash(str, len));
+    if (slot->Name == NULL) {
+        return Param_Error;
+    }
+    param->Type = Param_ValueType_Enum;
+    param->Enum = slot->Value;
+    return Param_Ok;
+}
+#endif // PARAM_TYPE_ENUM
+#if PARAM_TYPE_STATE
+/**
+ * @brief parse state strings
+ * ex: "high" -> 1 or "low" -> 0
+ *
+ * @param cursor
+ * @param param
+ * @return Param_Result
+ */
+Param_Result Param_parseState(char* str, Param_Value* param) {
+    return Param_parseKeywordType(str, Param_ValueType_State, param);
+}
+#endif // PARAM_TYPE_STATE
+#if PARAM_TYPE_STATE_KEY
+/**
+ * @brief parse state key strings
+ * ex: "on" -> 1 or "off" -> 0
+ *
+ * @param cursor
+ * @param param
+ * @return Param_Result
+ */
+Param_Result Param_parseStateKey(char* str, Param_Value* param) {
+    return Param_parseKeywordType(str, Param_ValueType_StateKey, param);
+}
+#endif // PARAM_TYPE_STATE_KEY
+#if PARAM_TYPE_BOOLEAN
+/**
+ * @brief parse boolean strings
+ * ex: "true" -> true or "false" -> false
+ *
+ * @param cursor
+ * @param param
+ * @return Param_Result
+ */
+Param_Result Param_parseBoolean(char* str, Param_Value* param) {
+    return Param_parseKeywordType(str, Param_ValueType_Boolean, param);
 }
 #endif // PARAM_TYPE_BOOLEAN
 #if PARAM_TYPE_NULL
@@ -486,23 +2397,7 @@ Param_Result Param_parseBoolean(char* str, Param_Value* param) {
  * @return Param_Result
  */
 Param_Result Param_parseNull(char* str, Param_Value* param) {
-    __convert(str);
-    if (
-    #if PARAM_CASE_MODE == PARAM_CASE_LOWER
-        Str_compare(str, "null") == 0
-    #elif PARAM_CASE_MODE == PARAM_CASE_HIGHER
-        Str_compare(str, "NULL") == 0
-    #else
-        Str_compare(str, "null") == 0
-    #endif
-    ) {
-        param->Type = Param_ValueType_Null;
-        param->Null = str;
-        return Param_Ok;
-    }
-    else {
-        return Param_Error;
-    }
+    return Param_parseKeywordType(str, Param_ValueType_Null, param);
 }
 #endif // PARAM_TYPE_NULL
 /**
@@ -517,6 +2412,87 @@ Param_Result Param_parseUnknown(char* str, Param_Value* param) {
     param->Unknown = str;
     return Param_Ok;
 }
+/**
+ * @brief parse a param without modify it, String, Null and Unknown values returned as views
+ * ex: "\"Text\"" -> StringView (Text, 4)
+ *
+ * @param str start of param, no need to be null terminated
+ * @param len length of param
+ * @param param
+ * @return Param_Result
+ */
+Param_Result Param_parseView(const char* str, Str_LenType len, Param_Value* param) {
+    Param_Result res = Param_Error;
+    __PARAM_STATS_BEGIN();
+
+    if (len > 0) {
+        switch (*str) {
+        #if PARAM_TYPE_NUMBER
+            case '0':
+            case '1':
+            case '2':
+            case '3':
+            case '4':
+            case '5':
+            case '6':
+            case '7':
+            case '8':
+            case '9':
+            case '-':
+                res = Param_parseNumberToken(str, len, param);
+                break;
+        #endif // PARAM_TYPE_NUMBER
+        #if PARAM_TYPE_STRING
+            case '"':
+                // string must end with not escaped double quote
+                if (len >= 2 && str[len - 1] == '"') {
+                    Str_LenType escapes = 0;
+                    while (len - 2 - escapes > 0 && str[len - 2 - escapes] == '\\') {
+                        escapes++;
+                    }
+                    if ((escapes & 1) == 0) {
+                        param->Type = Param_ValueType_StringView;
+                        param->StringView = str + 1;
+                        param->Len = len - 2;
+                        res = Param_Ok;
+                    }
+                }
+                break;
+        #endif // PARAM_TYPE_STRING
+        #if __PARAM_TYPE_KEYWORD || PARAM_TYPE_ENUM || __PARAM_TYPE_NON_FINITE
+            default:
+            #if PARAM_TYPE_ENUM
+                res = Param_parseEnum(str, len, param);
+            #endif
+            #if __PARAM_TYPE_KEYWORD
+                if (res != Param_Ok) {
+                    res = Param_parseKeyword(str, len, param);
+                    if (res == Param_Ok && param->Type == Param_ValueType_Null) {
+                        param->Type = Param_ValueType_NullView;
+                        param->Len = len;
+                    }
+                }
+            #endif
+            #if __PARAM_TYPE_NON_FINITE
+                if (res != Param_Ok) {
+                    res = Param_parseNonFinite(str, len, param);
+                }
+            #endif
+                break;
+        #endif // __PARAM_TYPE_KEYWORD || PARAM_TYPE_ENUM || __PARAM_TYPE_NON_FINITE
+        }
+    }
+
+    // check if param is not valid
+    if (res != Param_Ok) {
+        param->Type = Param_ValueType_UnknownView;
+        param->UnknownView = str;
+        param->Len = len;
+    }
+    __PARAM_STATS_TOKEN(param, res);
+
+    return res;
+}
 /**
  * @brief compare param values, first ValueType and second Value
  *
@@ -556,6 +2532,10 @@ char Param_compareValue(Param_Value* a, Param_Value* b) {
         __compareCase(State);
         __compareCase(StateKey);
         __compareCase(Boolean);
+    #if PARAM_TYPE_ENUM
+        case Param_ValueType_Enum:
+            return a->Enum.Table == b->Enum.Table && a->Enum.Ordinal == b->Enum.Ordinal;
+    #endif
         case Param_ValueType_Null:
         #if PARAM_COMPARE_NULL_VAL
             return Str_compare(a->Null, b->Null) == 0;
@@ -568,35 +2548,551 @@ char Param_compareValue(Param_Value* a, Param_Value* b) {
         #else
             return 1;
         #endif // PARAM_COMPARE_UNKNOWN_VAL
+        case Param_ValueType_StringView:
+            return a->Len == b->Len && memcmp(a->StringView, b->StringView, a->Len) == 0;
+        case Param_ValueType_NullView:
+        #if PARAM_COMPARE_NULL_VAL
+            return a->Len == b->Len && memcmp(a->NullView, b->NullView, a->Len) == 0;
+        #else
+            return 1;
+        #endif // PARAM_COMPARE_NULL_VAL
+        case Param_ValueType_UnknownView:
+        #if PARAM_COMPARE_UNKNOWN_VAL
+            return a->Len == b->Len && memcmp(a->UnknownView, b->UnknownView, a->Len) == 0;
+        #else
+            return 1;
+        #endif // PARAM_COMPARE_UNKNOWN_VAL
         default:
             return 0;
     }
 }
+/**
+ * @brief hash bytes of string values
+ */
+static uint32_t Param_hashBytes(const char* str, Str_LenType len) {
+    uint32_t hash = __keyHashInit;
+    while (len-- > 0) {
+        hash = __keyHashStep(hash, *str++);
+    }
+    return hash;
+}
+/**
+ * @brief hash param value, values that Param_compareValue see equal have same hash
+ * -0.0 and 0.0 have same hash, NaN is never equal to other values
+ *
+ * @param value
+ * @return uint32_t
+ */
+uint32_t Param_hashValue(const Param_Value* value) {
+#define __hashCase(TY) \
+    case Param_ValueType_ ##TY: \
+        bits = (uint64_t) value->TY; \
+        break
+
+    uint64_t bits = 0;
+    uint32_t bits32;
+
+    switch (value->Type) {
+        __hashCase(Number);
+        __hashCase(UNumber);
+        __hashCase(NumberHex);
+        __hashCase(NumberBinary);
+        __hashCase(UInt8);
+        __hashCase(Int8);
+        __hashCase(UInt16);
+        __hashCase(Int16);
+        __hashCase(UInt32);
+        __hashCase(Int32);
+    #if PARAM_TYPE_64BIT
+        __hashCase(UInt64);
+        __hashCase(Int64);
+        case Param_ValueType_Double:
+            // -0.0 equal to 0.0
+            if (value->Double != 0.0) {
+                memcpy(&bits, &value->Double, sizeof(bits));
+            }
+            break;
+    #endif
+        case Param_ValueType_Float:
+            if (value->Float != 0.0f) {
+                memcpy(&bits32, &value->Float, sizeof(bits32));
+                bits = bits32;
+            }
+            break;
+        __hashCase(State);
+        __hashCase(StateKey);
+        __hashCase(Boolean);
+    #if PARAM_TYPE_ENUM
+        case Param_ValueType_Enum:
+            bits = ((uint64_t) value->Enum.Table << 8) | value->Enum.Ordinal;
+            break;
+    #endif
+        case Param_ValueType_String:
+            bits = Param_hashBytes(value->String, Str_len(value->String));
+            break;
+        case Param_ValueType_StringView:
+            bits = Param_hashBytes(value->StringView, value->Len);
+            break;
+    #if PARAM_COMPARE_NULL_VAL
+        case Param_ValueType_Null:
+            bits = Param_hashBytes(value->Null, Str_len(value->Null));
+            break;
+        case Param_ValueType_NullView:
+            bits = Param_hashBytes(value->NullView, value->Len);
+            break;
+    #endif // PARAM_COMPARE_NULL_VAL
+    #if PARAM_COMPARE_UNKNOWN_VAL
+        case Param_ValueType_Unknown:
+            bits = Param_hashBytes(value->Unknown, Str_len(value->Unknown));
+            break;
+        case Param_ValueType_UnknownView:
+            bits = Param_hashBytes(value->UnknownView, value->Len);
+            break;
+    #endif // PARAM_COMPARE_UNKNOWN_VAL
+        default:
+            break;
+    }
+    // mix type and value, finalizer of MurmurHash3
+    bits ^= (uint64_t) value->Type << 56;
+    bits ^= bits >> 33;
+    bits *= 0xFF51AFD7ED558CCDULL;
+    bits ^= bits >> 33;
+    bits *= 0xC4CEB9FE1A85EC53ULL;
+    bits ^= bits >> 33;
+    return (uint32_t) bits;
+#undef __hashCase
+}
+/**
+ * @brief return bytes of string category values that take part in order and compare
+ *
+ * @param value
+ * @param len
+ * @return const char* bytes, or NULL if value is not string or its text is not compared
+ */
+static const char* Param_valueBytes(const Param_Value* value, Str_LenType* len) {
+    switch (value->Type) {
+        case Param_ValueType_String:
+    #if PARAM_COMPARE_NULL_VAL
+        case Param_ValueType_Null:
+    #endif
+    #if PARAM_COMPARE_UNKNOWN_VAL
+        case Param_ValueType_Unknown:
+    #endif
+            *len = Str_len(value->String);
+            return value->String;
+        case Param_ValueType_StringView:
+    #if PARAM_COMPARE_NULL_VAL
+        case Param_ValueType_NullView:
+    #endif
+    #if PARAM_COMPARE_UNKNOWN_VAL
+        case Param_ValueType_UnknownView:
+    #endif
+            *len = value->Len;
+            return value->StringView;
+        default:
+            return NULL;
+    }
+}
+/**
+ * @brief extract order-preserving key of value, radix sort of (Class, Key, Type) give Param_orderValue order
+ * - signed integers map to two's complement and class split negatives, unsigned integers keep value
+ * - floats map IEEE-754 bits so negative values reverse, -0.0 before 0.0, NaN at ends
+ * - strings use first 8 bytes in big-endian
+ *
+ * @param value
+ * @param key
+ */
+void Param_sortKey(const Param_Value* value, Param_SortKey* key) {
+#define __signedCase(TY) \
+    case Param_ValueType_ ##TY: \
+        key->Key = (uint64_t)(int64_t) value->TY; \
+        key->Class = Param_Category_Number | (value->TY >= 0); \
+        break
+#define __unsignedCase(TY) \
+    case Param_ValueType_ ##TY: \
+        key->Key = (uint64_t) value->TY; \
+        key->Class = Param_Category_Number | 1; \
+        break
+
+    const char* str;
+    Str_LenType len;
+    uint32_t bits32;
+#if PARAM_TYPE_64BIT
+    uint64_t bits64;
+#endif
+    uint8_t i;
+
+    key->Type = (uint8_t) value->Type;
+    key->Key = 0;
+    switch (value->Type) {
+        __signedCase(Number);
+        __signedCase(Int8);
+        __signedCase(Int16);
+        __signedCase(Int32);
+        __unsignedCase(UNumber);
+        __unsignedCase(NumberHex);
+        __unsignedCase(NumberBinary);
+        __unsignedCase(UInt8);
+        __unsignedCase(UInt16);
+        __unsignedCase(UInt32);
+    #if PARAM_TYPE_64BIT
+        __signedCase(Int64);
+        __unsignedCase(UInt64);
+        case Param_ValueType_Double:
+            memcpy(&bits64, &value->Double, sizeof(bits64));
+            key->Key = (bits64 >> 63) ? ~bits64 : bits64 | ((uint64_t) 1 << 63);
+            key->Class = Param_Category_Double;
+            break;
+    #endif
+        case Param_ValueType_Float:
+            memcpy(&bits32, &value->Float, sizeof(bits32));
+            key->Key = (bits32 >> 31) ? (uint32_t) ~bits32 : bits32 | ((uint32_t) 1 << 31);
+            key->Class = Param_Category_Float;
+            break;
+    #if PARAM_TYPE_ENUM
+        case Param_ValueType_Enum:
+            key->Key = ((uint64_t) value->Enum.Table << 8) | value->Enum.Ordinal;
+            key->Class = Param_Category_Enum;
+            break;
+    #endif
+        case Param_ValueType_Boolean:
+        case Param_ValueType_State:
+        case Param_ValueType_StateKey:
+            key->Key = value->Boolean;
+            key->Class = Param_Category_Boolean;
+            break;
+        case Param_ValueType_Null:
+        case Param_ValueType_NullView:
+            key->Class = Param_Category_String;
+            break;
+        case Param_ValueType_String:
+        case Param_ValueType_StringView:
+            key->Class = Param_Category_String | 1;
+            break;
+        default:
+            // Unknown and UnknownView
+            key->Class = Param_Category_String | 2;
+            break;
+    }
+    str = Param_valueBytes(value, &len);
+    if (str != NULL) {
+        for (i = 0; i < 8; i++) {
+            key->Key = (key->Key << 8) | (i < len ? (uint8_t) str[i] : 0);
+        }
+    }
+#undef __signedCase
+#undef __unsignedCase
+}
+/**
+ * @brief order of values without type, values of different types with same value are equal
+ *
+ * @param a
+ * @param b
+ * @return int8_t -1 if a is before b, 1 if a is after b, 0 if equal
+ */
+static int8_t Param_orderByValue(const Param_Value* a, const Param_Value* b) {
+    Param_SortKey ka;
+    Param_SortKey kb;
+    const char* strA;
+    const char* strB;
+    Str_LenType lenA = 0;
+    Str_LenType lenB = 0;
+    int res;
+
+    Param_sortKey(a, &ka);
+    Param_sortKey(b, &kb);
+    if (ka.Class != kb.Class) {
+        return ka.Class < kb.Class ? -1 : 1;
+    }
+    if (ka.Key != kb.Key) {
+        return ka.Key < kb.Key ? -1 : 1;
+    }
+    // strings with same prefix
+    strA = Param_valueBytes(a, &lenA);
+    strB = Param_valueBytes(b, &lenB);
+    if (strA != NULL && strB != NULL && (lenA > 8 || lenB > 8)) {
+        res = memcmp(strA, strB, (size_t)(lenA < lenB ? lenA : lenB));
+        if (res != 0) {
+            return res < 0 ? -1 : 1;
+        }
+        if (lenA != lenB) {
+            return lenA < lenB ? -1 : 1;
+        }
+    }
+    return 0;
+}
+/**
+ * @brief total order of values, first Param_Category_Number, Boolean, Float, Double, String and Enum
+ * - numbers order by value, signed and unsigned types are compared by value
+ * - Boolean, State and StateKey order by value, enums by table and ordinal
+ * - Float and Double order like IEEE-754 totalOrder, -0.0 before 0.0
+ * - Null before String and views, Unknown at end, strings order by bytes
+ * values with same order and different types order by Param_ValueType
+ *
+ * @param a
+ * @param b
+ * @return int8_t -1 if a is before b, 1 if a is after b, 0 if equal
+ */
+int8_t Param_orderValue(const Param_Value* a, const Param_Value* b) {
+    int8_t order = Param_orderByValue(a, b);
+
+    if (order == 0 && a->Type != b->Type) {
+        return a->Type < b->Type ? -1 : 1;
+    }
+    return order;
+}
+/**
+ * @brief bounded output, skip bytes that written in previous calls and stop when buffer is full
+ */
+typedef struct {
+    char*               Ptr;
+    Str_LenType         Len;        /**< remaining space of buffer */
+    Str_LenType         Skip;       /**< number of bytes that must skip before writing */
+    uint8_t             Full;       /**< a write truncated by end of buffer */
+} Param_Writer;
+/**
+ * @brief write part of src that not skipped and fit in buffer
+ *
+ * @param writer
+ * @param src
+ * @param len
+ */
+static void Param_write(Param_Writer* writer, const char* src, Str_LenType len) {
+    if (writer->Skip >= len) {
+        writer->Skip -= len;
+        return;
+    }
+    src += writer->Skip;
+    len -= writer->Skip;
+    writer->Skip = 0;
+    if (len > writer->Len) {
+        len = writer->Len;
+        writer->Full = 1;
+    }
+    memcpy(writer->Ptr, src, len);
+    writer->Ptr += len;
+    writer->Len -= len;
+}
+/**
+ * @brief number of string characters that escape in each Str_convertString call
+ */
+#define PARAM_STRING_CHUNK_LEN          32
+/**
+ * @brief quote and escape string with Str_convertString in small chunks, so output can be measured
+ * or written to bounded buffer, escape of each character is independent and chunks give same output as whole string
+ *
+ * @param writer output, or NULL to only measure
+ * @param value
+ * @return Str_LenType length of quoted and escaped string, same as Param_valueToStr
+ */
+static Str_LenType Param_writeString(Param_Writer* writer, const char* value) {
+    char chunk[PARAM_STRING_CHUNK_LEN + 1];
+    char out[PARAM_STRING_CHUNK_LEN * 4 + 3];
+    Str_LenType total = 2;
+    Str_LenType len;
+
+    if (writer != NULL) {
+        Param_write(writer, "\"", 1);
+    }
+    while (*value != '\0' && (writer == NULL || !writer->Full)) {
+        for (len = 0; len < PARAM_STRING_CHUNK_LEN && value[len] != '\0'; len++) {
+            chunk[len] = value[len];
+        }
+        chunk[len] = '\0';
+        value += len;
+        // output without quotes
+        len = (Str_LenType)(Str_convertString(chunk, out) - out) - 2;
+        if (writer != NULL) {
+            Param_write(writer, out + 1, len);
+        }
+        total += len;
+    }
+    if (writer != NULL) {
+        Param_write(writer, "\"", 1);
+    }
+    return total;
+}
+/**
+ * @brief write value in bounded output, same output as Param_valueToStr
+ *
+ * @param writer
+ * @param value
+ */
+static void Param_writeValue(Param_Writer* writer, Param_Value* value) {
+    char tmp[PARAM_VALUE_STR_LEN];
+
+    switch (value->Type) {
+        case Param_ValueType_String:
+            Param_writeString(writer, value->String);
+            break;
+    #if PARAM_TYPE_ENUM
+        case Param_ValueType_Enum:
+            if (Param_enumName(value->Enum) != NULL) {
+                Param_write(writer, Param_enumName(value->Enum), Str_len(Param_enumName(value->Enum)));
+            }
+            break;
+    #endif
+        case Param_ValueType_Unknown:
+            Param_write(writer, value->Unknown, Str_len(value->Unknown));
+            break;
+        case Param_ValueType_StringView:
+            Param_write(writer, "\"", 1);
+            Param_write(writer, value->StringView, value->Len);
+            Param_write(writer, "\"", 1);
+            break;
+        case Param_ValueType_UnknownView:
+            Param_write(writer, value->UnknownView, value->Len);
+            break;
+        default:
+            // numbers and keywords are short, render them first
+            Param_write(writer, tmp, Param_valueToStr(tmp, value));
+            break;
+    }
+}
 /**
  * @brief convert array of values to string
  *
  * @param str
  * @param values
  * @param len
- * @param separator
+ * @param separator can be NULL
  * @return Str_LenType
  */
 Str_LenType Param_toStr(char* str, Param_Value* values, Param_LenType len, char* separator) {
     char* base = str;
-    Str_LenType sepLen = Str_len(separator);
+    Str_LenType sepLen = separator != NULL ? Str_len(separator) : 0;
+
+    if (len <= 0) {
+        *str = '\0';
+        return 0;
+    }
     while (--len > 0) {
         // convert value
         str += Param_valueToStr(str, values++);
         // add separator
         if (separator) {
-            Str_copy(str, separator);
+            memcpy(str, separator, sepLen);
             str += sepLen;
         }
     }
     // convert value
     str += Param_valueToStr(str, values++);
+    *str = '\0';
     return (Str_LenType)(str - base);
 }
+/**
+ * @brief return length of Param_toStr output without null terminator, use it for allocate buffer
+ *
+ * @param values
+ * @param len
+ * @param separator can be NULL
+ * @return Str_LenType
+ */
+Str_LenType Param_toStrLen(Param_Value* values, Param_LenType len, const char* separator) {
+    Str_LenType sepLen = separator != NULL ? Str_len(separator) : 0;
+    Str_LenType total;
+
+    if (len <= 0) {
+        return 0;
+    }
+    total = sepLen * (len - 1);
+    while (len-- > 0) {
+        total += Param_valueToStrLen(values++);
+    }
+    return total;
+}
+/**
+ * @brief convert array of values to string in a limited buffer, never write more than size bytes,
+ * if buffer is full, pos keep the progress and next call continue from there
+ *
+ * @param str output buffer
+ * @param size size of output buffer
+ * @param values
+ * @param len
+ * @param separator can be NULL
+ * @param pos progress of conversion, set it to zero before first call, done when pos->Index == len
+ * @return Str_LenType number of bytes written, null terminator only add when there is space after last value
+ */
+Str_LenType Param_toStrN(char* str, Str_LenType size, Param_Value* values, Param_LenType len, const char* separator, Param_ToStrPos* pos) {
+    Param_Writer writer;
+    Str_LenType sepLen = separator != NULL ? Str_len(separator) : 0;
+    char* pStart;
+
+    writer.Ptr = str;
+    writer.Len = size;
+    writer.Full = 0;
+    while (pos->Index < len && !writer.Full) {
+        writer.Skip = pos->Offset;
+        pStart = writer.Ptr;
+        Param_writeValue(&writer, &values[pos->Index]);
+        if (pos->Index + 1 < len) {
+            Param_write(&writer, separator, sepLen);
+        }
+        if (writer.Full) {
+            pos->Offset += (Str_LenType)(writer.Ptr - pStart);
+        }
+        else {
+            pos->Index++;
+            pos->Offset = 0;
+        }
+    }
+    if (pos->Index >= len && writer.Len > 0) {
+        *writer.Ptr = '\0';
+    }
+    return (Str_LenType)(writer.Ptr - str);
+}
+/**
+ * @brief return length of Param_valueToStr output without null terminator
+ *
+ * @param value
+ * @return Str_LenType
+ */
+Str_LenType Param_valueToStrLen(Param_Value* value) {
+#define __valueToStrLenCaseSigned(TY) \
+    case Param_ValueType_ ##TY: \
+        return value->TY < 0 ? Param_unumberLen((Param_UNumber) 0 - (Param_UNumber) value->TY) + 1 \
+                             : Param_unumberLen((Param_UNumber) value->TY);
+
+#define __valueToStrLenCaseUnsigned(TY) \
+    case Param_ValueType_ ##TY: \
+        return Param_unumberLen((Param_UNumber) value->TY);
+
+    char tmp[PARAM_VALUE_STR_LEN];
+
+    switch (value->Type) {
+        __valueToStrLenCaseSigned(Number);
+        __valueToStrLenCaseSigned(Int8);
+        __valueToStrLenCaseSigned(Int16);
+        __valueToStrLenCaseSigned(Int32);
+        __valueToStrLenCaseUnsigned(UNumber);
+        __valueToStrLenCaseUnsigned(UInt8);
+        __valueToStrLenCaseUnsigned(UInt16);
+        __valueToStrLenCaseUnsigned(UInt32);
+    #if PARAM_TYPE_64BIT
+        __valueToStrLenCaseSigned(Int64);
+        __valueToStrLenCaseUnsigned(UInt64);
+    #endif
+        case Param_ValueType_NumberHex:
+            return Param_hexLen(value->NumberHex) + PARAM_DEFAULT_HEX_LEN;
+        case Param_ValueType_NumberBinary:
+            return Param_binaryLen(value->NumberBinary) + PARAM_DEFAULT_BIN_LEN;
+        case Param_ValueType_String:
+            return Param_writeString(NULL, value->String);
+    #if PARAM_TYPE_ENUM
+        case Param_ValueType_Enum:
+            return Param_enumName(value->Enum) != NULL ? Str_len(Param_enumName(value->Enum)) : 0;
+    #endif
+        case Param_ValueType_Unknown:
+            return Str_len(value->Unknown);
+        case Param_ValueType_StringView:
+            return value->Len + 2;
+        case Param_ValueType_UnknownView:
+            return value->Len;
+        default:
+            // floats and keywords are short, render them
+            return Param_valueToStr(tmp, value);
+    }
+}
 /**
  * @brief convert value to string and return string length
  *
@@ -605,61 +3101,42 @@ Str_LenType Param_toStr(char* str, Param_Value* values, Param_LenType len, char*
  * @return Str_LenType
  */
 Str_LenType Param_valueToStr(char* str, Param_Value* value) {
-#define __valueToStrCase32(TY) \
+#define __valueToStrCaseSigned(TY) \
     case Param_ValueType_ ##TY: \
-        return Str_parseNum(value->TY, Str_Decimal, STR_NORMAL_LEN, str);
+        return Param_numberToStr(str, (Param_Number) value->TY);
 
-#define __valueToStrCase64(TY) \
+#define __valueToStrCaseUnsigned(TY) \
     case Param_ValueType_ ##TY: \
-        return Str_parseNum(value->TY, Str_Decimal, STR_NORMAL_LEN, str);
+        return Param_unumberToStr(str, (Param_UNumber) value->TY);
 
     char* pStr;
 
     switch (value->Type) {
-        __valueToStrCase32(Int8);
-        __valueToStrCase32(Int16);
-        __valueToStrCase32(Int32);
-        __valueToStrCase32(UInt8);
-        __valueToStrCase32(UInt16);
-        __valueToStrCase32(UInt32);
-
-        case Param_ValueType_Number:
-        #if PARAM_TYPE_64BIT
-            return Str_parseLong(value->Number, Str_Decimal, STR_NORMAL_LEN, str);
-        #else
-            return Str_parseNum(value->Number, Str_Decimal, STR_NORMAL_LEN, str);
-        #endif
-
-        case Param_ValueType_UNumber:
-        #if PARAM_TYPE_64BIT
-            return Str_parseULong(value->UNumber, Str_Decimal, STR_NORMAL_LEN, str);
-        #else
-            return Str_parseUNum(value->UNumber, Str_Decimal, STR_NORMAL_LEN, str);
-        #endif
-        
+        __valueToStrCaseSigned(Number);
+        __valueToStrCaseSigned(Int8);
+        __valueToStrCaseSigned(Int16);
+        __valueToStrCaseSigned(Int32);
+        __valueToStrCaseUnsigned(UNumber);
+        __valueToStrCaseUnsigned(UInt8);
+        __valueToStrCaseUnsigned(UInt16);
+        __valueToStrCaseUnsigned(UInt32);
     #if PARAM_TYPE_64BIT
-        __valueToStrCase64(Int64);
-        __valueToStrCase64(UInt64);
+        __valueToStrCaseSigned(Int64);
+        __valueToStrCaseUnsigned(UInt64);
     #endif
         case Param_ValueType_NumberHex:
             Str_copy(str, PARAM_DEFAULT_HEX);
-        #if PARAM_TYPE_64BIT
-            return Str_parseLong(value->NumberHex, Str_Hex, STR_NORMAL_LEN, str + PARAM_DEFAULT_HEX_LEN) + PARAM_DEFAULT_HEX_LEN;
-        #else
-            return Str_parseNum(value->NumberHex, Str_Hex, STR_NORMAL_LEN, str + PARAM_DEFAULT_HEX_LEN) + PARAM_DEFAULT_HEX_LEN;
-        #endif
-            
+            return Param_hexToStr(str + PARAM_DEFAULT_HEX_LEN, value->NumberHex) + PARAM_DEFAULT_HEX_LEN;
+
         case Param_ValueType_NumberBinary:
             Str_copy(str, PARAM_DEFAULT_BIN);
-        #if PARAM_TYPE_64BIT
-            return Str_parseLong(value->NumberBinary, Str_Binary, STR_NORMAL_LEN, str + PARAM_DEFAULT_BIN_LEN) + PARAM_DEFAULT_BIN_LEN;
-        #else
-            return Str_parseNum(value->NumberBinary, Str_Binary, STR_NORMAL_LEN, str + PARAM_DEFAULT_BIN_LEN) + PARAM_DEFAULT_BIN_LEN;
-        #endif
+            return Param_binaryToStr(str + PARAM_DEFAULT_BIN_LEN, value->NumberBinary) + PARAM_DEFAULT_BIN_LEN;
 
         case Param_ValueType_Float:
         #if PARAM_FLOAT_DECIMAL_LEN != 0
             return Str_parseFloatFix(value->Float, str, PARAM_FLOAT_DECIMAL_LEN);
+        #elif PARAM_FLOAT_FORMAT == PARAM_FLOAT_FORMAT_SHORTEST
+            return Param_floatToStr(str, value->Float);
         #else
             return Str_parseFloat(value->Float, str);
         #endif
@@ -668,6 +3145,12 @@ Str_LenType Param_valueToStr(char* str, Param_Value* value) {
         case Param_ValueType_Double:
         #if PARAM_FLOAT_DECIMAL_LEN != 0
             return Str_parseDoubleFix(value->Double, str, PARAM_FLOAT_DECIMAL_LEN);
+        #elif PARAM_FLOAT_FORMAT == PARAM_FLOAT_FORMAT_SHORTEST
+        {
+            Str_LenType len = Param_doubleToStr(str, value->Double);
+            Str_copy(str + len, PARAM_DEFAULT_DOUBLE);
+            return len + PARAM_DEFAULT_DOUBLE_LEN;
+        }
         #else
             return Str_parseDouble(value->Double, str);
         #endif
@@ -702,12 +3185,33 @@ Str_LenType Param_valueToStr(char* str, Param_Value* value) {
                 Str_copy(str, PARAM_DEFAULT_FALSE);
                 return PARAM_DEFAULT_FALSE_LEN;
             }
+    #if PARAM_TYPE_ENUM
+        case Param_ValueType_Enum:
+            if (Param_enumName(value->Enum) == NULL) {
+                *str = '\0';
+                return 0;
+            }
+            Str_copy(str, Param_enumName(value->Enum));
+            return Str_len(str);
+    #endif
         case Param_ValueType_Null:
+        case Param_ValueType_NullView:
             Str_copy(str, PARAM_DEFAULT_NULL);
             return PARAM_DEFAULT_NULL_LEN;
         case Param_ValueType_Unknown:
             Str_copy(str, value->Unknown);
             return Str_len(value->Unknown);
+        case Param_ValueType_StringView:
+            // view keep body of string as it is, so escapes are already in place
+            *str = '"';
+            memcpy(str + 1, value->StringView, value->Len);
+            str[value->Len + 1] = '"';
+            str[value->Len + 2] = '\0';
+            return value->Len + 2;
+        case Param_ValueType_UnknownView:
+            memcpy(str, value->UnknownView, value->Len);
+            str[value->Len] = '\0';
+            return value->Len;
         default:
             return 0;
     }
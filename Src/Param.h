@@ -21,6 +21,7 @@ extern "C" {
 
 #include "Str.h"
 #include <stdint.h>
+#include <stddef.h>
 
 /********************************************************************************************/
 /*                                     Configuration                                        */
@@ -68,14 +69,40 @@ extern "C" {
  * @brief enable value type null
  */
 #define PARAM_TYPE_NULL                 1
+/**
+ * @brief enable user enum types, tables register with Param_registerEnum
+ */
+#define PARAM_TYPE_ENUM                 1
 /**
  * @brief enable 64bit variables
  */
 #define PARAM_TYPE_64BIT                1
+/**
+ * @brief enable hot-path statistics, counters are per thread and aggregate with Param_statsSnapshot
+ */
+#define PARAM_STATS                     0
+/**
+ * @brief enable cycle counter histograms of parse functions in statistics, need PARAM_STATS
+ */
+#define PARAM_STATS_CYCLES              0
+/**
+ * @brief number of threads that have own statistics, at least workers of Param_parseBulk,
+ * counters of later threads are dropped and counted in Dropped of snapshot
+ */
+#define PARAM_STATS_THREADS             64
 /**
  * @brief define toStr decimal length, 0 means all digits
  */
 #define PARAM_FLOAT_DECIMAL_LEN         0
+/**
+ * Float formatter implementations, used when PARAM_FLOAT_DECIMAL_LEN is 0
+ */
+#define PARAM_FLOAT_FORMAT_STR          0       /**< Str library */
+#define PARAM_FLOAT_FORMAT_SHORTEST     1       /**< Built-in Ryu, shortest digits that parse back to same value */
+/**
+ * @brief Define float and double formatter of toStr
+ */
+#define PARAM_FLOAT_FORMAT              PARAM_FLOAT_FORMAT_SHORTEST
 /**
  * @brief This macro help you to define the maximum number of parameters.
  */
@@ -98,6 +125,83 @@ typedef int16_t Param_LenType;
  * @brief Defien param system byte order
  */
 #define PARAM_SYSTEM_BYTE_ORDER         PARAM_SYSTEM_BYTE_ORDER_AU
+/**
+ * Separator scanner implementations
+ */
+#define PARAM_SCAN_BYTE                 0       /**< Byte-at-a-time scanner */
+#define PARAM_SCAN_SWAR                 1       /**< Portable 8 bytes per step scanner */
+#define PARAM_SCAN_SIMD                 2       /**< SSE2/AVX2/NEON if compiler support it, otherwise SWAR */
+/**
+ * @brief Define scanner that Param_next use to find end of params
+ */
+#define PARAM_SCAN_MODE                 PARAM_SCAN_SIMD
+/**
+ * @brief number of params that Param_parseAll tokenize before parse them
+ */
+#define PARAM_BATCH_SIZE                32
+/**
+ * @brief size of key index of Param_KeyValues, must be power of 2, maximum number of key=value params is PARAM_KEY_INDEX_SIZE / 2
+ * so index is at most half full and probes stay short
+ */
+#define PARAM_KEY_INDEX_SIZE            128
+/**
+ * @brief separator of key and value in key=value params
+ */
+#define PARAM_KEY_SEPARATOR             '='
+/**
+ * @brief enable multi-threaded bulk parser (ParamBulk.h), need POSIX threads and malloc
+ */
+#define PARAM_BULK                      1
+/**
+ * @brief size of chunks that bulk parser workers take one by one, chunks end at record boundaries
+ */
+#define PARAM_BULK_CHUNK_SIZE           65536
+/**
+ * @brief enable binary TLV encoding of values (ParamBinary.h)
+ */
+#define PARAM_BINARY                    1
+/**
+ * @brief enable tape output of parsed lines (ParamTape.h), 8-byte tagged words per param
+ */
+#define PARAM_TAPE                      1
+/**
+ * @brief enable hash set and hash map of values (ParamSet.h)
+ */
+#define PARAM_VALUE_SET                 1
+/**
+ * @brief enable radix sort of values (ParamSort.h)
+ */
+#define PARAM_SORT                      1
+/**
+ * @brief keep radix histograms of Param_sortValues (10 KB) in static memory instead of stack,
+ * Param_sortValues is not reentrant when enabled
+ */
+#define PARAM_SORT_STATIC_HIST          0
+/**
+ * @brief enable memory-mapped file reader (ParamFile.h), need POSIX mmap
+ */
+#define PARAM_FILE                      1
+/**
+ * @brief maximum number of enum tables
+ */
+#define PARAM_ENUM_MAX_TABLES           8
+/**
+ * @brief size of enum names hash table, must be power of 2 and bigger than total number of enum names
+ */
+#define PARAM_ENUM_HASH_SIZE            64
+/**
+ * Float parser implementations
+ */
+#define PARAM_FLOAT_PARSER_STR          0       /**< Fast path for exact values, others use Str library */
+#define PARAM_FLOAT_PARSER_EXACT        1       /**< Built-in Eisel-Lemire with exact fallback, need 10KB table */
+/**
+ * @brief Define float and double parser, exact parser always return nearest value
+ */
+#define PARAM_FLOAT_PARSER              PARAM_FLOAT_PARSER_EXACT
+/**
+ * @brief maximum length of float params that Str parser can parse, they copied into stack to parse
+ */
+#define PARAM_VIEW_NUMBER_LEN           64
 
 /* Default Values for toStr */
 #define PARAM_DEFAULT_NULL              "Null"
@@ -109,6 +213,9 @@ typedef int16_t Param_LenType;
 #define PARAM_DEFAULT_LOW               "Low"
 #define PARAM_DEFAULT_HEX               "0x"
 #define PARAM_DEFAULT_BIN               "0b"
+#define PARAM_DEFAULT_DOUBLE            "f64"       /**< suffix of double in shortest format, parse back as double */
+#define PARAM_DEFAULT_NAN               "NaN"
+#define PARAM_DEFAULT_INF               "Inf"
 
 /********************************************************************************************/
 /**
@@ -126,6 +233,21 @@ typedef int16_t Param_LenType;
     typedef uint32_t        Param_NumberBin;
 #endif
 
+/**
+ * @brief value of enum types, table id from Param_registerEnum and index of name in table
+ */
+typedef struct {
+    uint8_t             Table;
+    uint8_t             Ordinal;
+} Param_Enum;
+/**
+ * @brief names of an enum type, index of name is ordinal, use PARAM_ENUM_TABLE to define it
+ */
+typedef struct {
+    const char* const*  Names;
+    uint8_t             Len;
+} Param_EnumTable;
+
 #include "ParamMacro.h"
 
 /**
@@ -145,6 +267,7 @@ typedef enum {
     Param_Category_Float            = 0x20,
     Param_Category_Double           = 0x30,
     Param_Category_String           = 0x40,
+    Param_Category_Enum             = 0x50,
     Param_Category_Mask             = 0xF0,
 } Param_Category;
 /**
@@ -175,39 +298,70 @@ typedef enum {
     Param_ValueType_String          = Param_Category_String,    /**< ex: "Text" */
     Param_ValueType_Null,                                       /**< ex: null */
     Param_ValueType_Unknown,                                    /**< first character of value not match with any of supported values */
+    Param_ValueType_StringView,                                 /**< String in view mode, (ptr, len) of body between quotes */
+    Param_ValueType_NullView,                                   /**< Null in view mode, (ptr, len) */
+    Param_ValueType_UnknownView,                                /**< Unknown in view mode, (ptr, len) */
+#if PARAM_TYPE_ENUM
+    Param_ValueType_Enum            = Param_Category_Enum,      /**< name of registered enum table, ex: auto */
+#endif
 } Param_ValueType;
+/**
+ * @brief fields of value, shared between Param_Value and Param_ValueData
+ */
+#if PARAM_TYPE_64BIT
+    #define __PARAM_VALUE_FIELDS_64BIT  \
+        PARAM_IMPL_VALUETYPE(UInt64);   \
+        PARAM_IMPL_VALUETYPE(Int64);    \
+        PARAM_IMPL_VALUETYPE(Double);
+#else
+    #define __PARAM_VALUE_FIELDS_64BIT
+#endif
+#if PARAM_TYPE_ENUM
+    #define __PARAM_VALUE_FIELDS_ENUM   \
+        PARAM_IMPL_VALUETYPE(Enum);
+#else
+    #define __PARAM_VALUE_FIELDS_ENUM
+#endif
+
+#define PARAM_VALUE_FIELDS                  \
+        PARAM_IMPL_VALUETYPE(Unknown);      \
+        PARAM_IMPL_VALUETYPE(Null);         \
+        PARAM_IMPL_VALUETYPE(Number);       \
+        PARAM_IMPL_VALUETYPE(UNumber);      \
+        PARAM_IMPL_VALUETYPE(NumberHex);    \
+        PARAM_IMPL_VALUETYPE(NumberBinary); \
+        PARAM_IMPL_VALUETYPE(UInt8);        \
+        PARAM_IMPL_VALUETYPE(Int8);         \
+        PARAM_IMPL_VALUETYPE(UInt16);       \
+        PARAM_IMPL_VALUETYPE(Int16);        \
+        PARAM_IMPL_VALUETYPE(UInt32);       \
+        PARAM_IMPL_VALUETYPE(Int32);        \
+        PARAM_IMPL_VALUETYPE(Float);        \
+        __PARAM_VALUE_FIELDS_64BIT          \
+        PARAM_IMPL_VALUETYPE(State);        \
+        PARAM_IMPL_VALUETYPE(StateKey);     \
+        PARAM_IMPL_VALUETYPE(Boolean);      \
+        __PARAM_VALUE_FIELDS_ENUM           \
+        PARAM_IMPL_VALUETYPE(String);       \
+        PARAM_IMPL_VALUETYPE(StringView);   \
+        PARAM_IMPL_VALUETYPE(NullView);     \
+        PARAM_IMPL_VALUETYPE(UnknownView)
 /**
  * @brief hold type of param in same memory
  */
 typedef struct {
     union {
-        PARAM_IMPL_VALUETYPE(Unknown);
-        PARAM_IMPL_VALUETYPE(Null);
-        PARAM_IMPL_VALUETYPE(Number);
-        PARAM_IMPL_VALUETYPE(UNumber);
-        PARAM_IMPL_VALUETYPE(NumberHex);
-        PARAM_IMPL_VALUETYPE(NumberBinary);
-        PARAM_IMPL_VALUETYPE(UInt8);
-        PARAM_IMPL_VALUETYPE(Int8);
-        PARAM_IMPL_VALUETYPE(UInt16);
-        PARAM_IMPL_VALUETYPE(Int16);
-        PARAM_IMPL_VALUETYPE(UInt32);
-        PARAM_IMPL_VALUETYPE(Int32);
-    #if PARAM_TYPE_64BIT
-        PARAM_IMPL_VALUETYPE(UInt64);
-        PARAM_IMPL_VALUETYPE(Int64);
-    #endif
-        PARAM_IMPL_VALUETYPE(Float);
-    #if PARAM_TYPE_64BIT
-        PARAM_IMPL_VALUETYPE(Double);
-    #endif
-        PARAM_IMPL_VALUETYPE(State);
-        PARAM_IMPL_VALUETYPE(StateKey);
-        PARAM_IMPL_VALUETYPE(Boolean);
-        PARAM_IMPL_VALUETYPE(String);
+        PARAM_VALUE_FIELDS;
     };
     Param_ValueType     Type;
+    Str_LenType         Len;        /**< length of view values, view values are not null terminated */
 } Param_Value;
+/**
+ * @brief value without type, use with separate array of Param_ValueType
+ */
+typedef union {
+    PARAM_VALUE_FIELDS;
+} Param_ValueData;
 /**
  * @brief show details of param
  */
@@ -224,17 +378,246 @@ typedef struct {
     char                ParamSeparator;
     Param_LenType       Index;
 } Param_Cursor;
+/**
+ * @brief type and place of a field in destination struct, use PARAM_FIELD to define it
+ */
+typedef struct {
+    Param_ValueType     Type;
+    uint16_t            Offset;     /**< offsetof field in struct */
+} Param_Field;
+/**
+ * @brief layout of params with known types, use with Param_parseInto
+ */
+typedef struct {
+    const Param_Field*  Fields;
+    Param_LenType       Len;
+} Param_Schema;
+/**
+ * @brief boundaries of params in a line for random access, use with Param_get
+ */
+typedef struct {
+    const char*         Ptr;
+    Str_LenType*        Offsets;        /**< offset of start of each param */
+    Str_LenType         End;            /**< offset of end of last indexed param */
+    Param_LenType       Len;            /**< number of indexed params */
+} Param_Index;
+/**
+ * @brief operator of filter condition
+ */
+typedef enum {
+    Param_FilterOp_Equal,                                       /**< Param_compareValue is equal */
+    Param_FilterOp_NotEqual,                                    /**< Param_compareValue is not equal */
+    Param_FilterOp_Less,                                        /**< same category and value is before, type of value is ignored, ex: 5i8 < 6 */
+    Param_FilterOp_LessEqual,
+    Param_FilterOp_Greater,                                     /**< same category and value is after, type of value is ignored */
+    Param_FilterOp_GreaterEqual,
+} Param_FilterOp;
+/**
+ * @brief condition on a param of line, ex: param 2 == "alarm"
+ */
+typedef struct {
+    Param_Value         Value;
+    Param_LenType       Index;      /**< index of param in line */
+    Param_FilterOp      Op;
+} Param_Condition;
+/**
+ * @brief all conditions must be true for a line, use Param_initFilter to compile it
+ */
+typedef struct {
+    Param_Condition*    Conditions;     /**< sorted by Index */
+    Param_LenType       Len;
+} Param_Filter;
+/**
+ * @brief cursor over records that each record has params, ex: CSV lines
+ */
+typedef struct {
+    char*               Ptr;
+    size_t              Len;
+    uint32_t            Record;         /**< number of records that read */
+    char                RecordSeparator;
+    char                ParamSeparator;
+} Param_TableCursor;
+/**
+ * @brief column of columnar output, value of each row store in a contiguous typed array
+ * use PARAM_COLUMN to define it
+ */
+typedef struct {
+    void*               Values;         /**< typed array, ex: int64_t[] for Int64, double[] for Double, char*[] for String */
+    uint8_t*            Valid;          /**< validity bitmap, bit (row & 7) of byte (row >> 3) set if param exists and match type, can be NULL */
+    Param_ValueType     Type;
+    uint8_t             Size;           /**< size of each value */
+} Param_Column;
+/**
+ * @brief columns of a table, all columns have space for Size rows
+ */
+typedef struct {
+    Param_Column*       Columns;
+    Param_LenType       Len;
+    uint32_t            Rows;           /**< number of rows that parsed */
+    uint32_t            Size;
+} Param_Columns;
+
+#if PARAM_STATS
+/**
+ * @brief parse functions that have cycle histogram
+ */
+typedef enum {
+    Param_StatsFn_Number,                   /**< numbers, hex and binary */
+    Param_StatsFn_String,
+    Param_StatsFn_Keyword,                  /**< keywords and enums */
+    Param_StatsFn_Unknown,                  /**< tokens that fallback to Param_parseUnknown */
+    Param_StatsFn_Max,
+} Param_StatsFn;
+/**
+ * @brief number of histogram buckets, bucket i count calls that take [2^i, 2^(i+1)) cycles
+ */
+#define PARAM_STATS_BUCKETS             24
+/**
+ * @brief hot-path counters
+ */
+typedef struct {
+    uint32_t            Tokens[Param_Category_Enum + 0x10];     /**< tokens per Param_ValueType */
+    uint32_t            Unknown;                                /**< tokens that fallback to Param_parseUnknown */
+    uint32_t            Suffix;                                 /**< numbers with type suffix */
+    uint64_t            Bytes;                                  /**< bytes scanned to find separators */
+    uint32_t            Dropped;                                /**< threads after PARAM_STATS_THREADS that not counted, only in snapshot */
+#if PARAM_STATS_CYCLES
+    uint32_t            Cycles[Param_StatsFn_Max][PARAM_STATS_BUCKETS];
+#endif
+} Param_Stats;
+#endif // PARAM_STATS
+
+/**
+ * @brief order-preserving key of value, values order by Class, Key and then Type
+ * Key is exact for all values except strings that longer than 8 bytes
+ */
+typedef struct {
+    uint64_t            Key;
+    uint8_t             Class;      /**< category of value, numbers split by sign and strings by null/string/unknown */
+    uint8_t             Type;
+    uint32_t            Index;      /**< index of value in sorted array */
+} Param_SortKey;
+/**
+ * @brief param with deferred conversion, use with Param_nextLazy
+ */
+typedef struct {
+    Param               Param;      /**< until Parsed, Value.Type is guess of first character: Number, NumberHex, NumberBinary, String or Unknown */
+    char*               Str;        /**< null terminated param string */
+    Str_LenType         Len;        /**< length of param string */
+    uint8_t             Parsed;     /**< value is converted */
+} Param_Lazy;
+/**
+ * @brief key=value param
+ */
+typedef struct {
+    Param               Param;      /**< in lazy mode value is converted on first Param_find */
+    char*               Key;        /**< null terminated key, NULL if param has no key */
+    char*               Str;        /**< null terminated value string */
+    Str_LenType         Len;        /**< length of value string */
+    uint8_t             Parsed;     /**< value is converted */
+    uint32_t            Hash;       /**< hash of key */
+} Param_KeyValue;
+/**
+ * @brief key=value params with open addressing index of keys
+ */
+typedef struct {
+    Param_KeyValue*     Params;
+    Param_LenType       Len;        /**< number of parsed params */
+    Param_LenType       Size;       /**< size of Params, maximum PARAM_KEY_INDEX_SIZE / 2 */
+    uint8_t             Lazy;       /**< convert values only when Param_find them */
+    uint8_t             Truncated;  /**< line has more params than Size, rest of line not parsed */
+    Param_LenType       Index[PARAM_KEY_INDEX_SIZE];    /**< index of params base on hash of key, -1 for empty */
+} Param_KeyValues;
+
+struct _Param_Stream;
+/**
+ * @brief callback of stream params, param and its views are valid only inside of callback
+ */
+typedef void (*Param_StreamFn)(struct _Param_Stream* stream, Param* param);
+/**
+ * @brief cursor for input that receive in chunks, keep only unfinished param between chunks
+ */
+typedef struct _Param_Stream {
+    Param_StreamFn      OnParam;
+    void*               Args;           /**< user argument */
+    char*               Buffer;         /**< keep unfinished param */
+    Str_LenType         Size;           /**< size of buffer, maximum length of param that split between chunks */
+    Str_LenType         Len;            /**< length of unfinished param */
+    Param_LenType       Index;
+    char                ParamSeparator;
+    char                LineEnd;        /**< end of line, finish last param and reset Index */
+    uint8_t             Overflow;       /**< unfinished param is longer than buffer */
+    uint8_t             Pending;        /**< any character received after last separator, even whitespace */
+} Param_Stream;
+/**
+ * @brief progress of Param_toStrN, initialize with zero
+ */
+typedef struct {
+    Param_LenType       Index;      /**< index of next value */
+    Str_LenType         Offset;     /**< bytes of next value and its separator that already written */
+} Param_ToStrPos;
 
 void Param_initCursor(Param_Cursor* cursor, char* ptr, Str_LenType len, char paramSeparator);
+void Param_initCursorView(Param_Cursor* cursor, const char* ptr, Str_LenType len, char paramSeparator);
 
 Param* Param_next(Param_Cursor* cursor, Param* param);
+Param_LenType Param_parseAll(Param_Cursor* cursor, Param* params, Param_LenType len);
+Param_LenType Param_parseAllValues(Param_Cursor* cursor, Param_ValueType* types, Param_ValueData* values, Param_LenType len);
+Param* Param_nextView(Param_Cursor* cursor, Param* param);
+Param_Lazy* Param_nextLazy(Param_Cursor* cursor, Param_Lazy* param);
+Param_Value* Param_getValue(Param_Lazy* param);
+Param_Result Param_getNumber(Param_Lazy* param, Param_Number* value);
+Param_Result Param_getFloat(Param_Lazy* param, float* value);
+#if PARAM_TYPE_64BIT
+    Param_Result Param_getDouble(Param_Lazy* param, double* value);
+#endif
+Param_LenType Param_parseInto(Param_Cursor* cursor, const Param_Schema* schema, void* dst);
+
+void Param_initFilter(Param_Filter* filter, Param_Condition* conditions, Param_LenType len);
+Param_LenType Param_parseFiltered(Param_Cursor* cursor, const Param_Filter* filter, Param* params, Param_LenType len);
+
+Param_LenType Param_index(Param_Index* index, const char* line, Str_LenType len, char paramSeparator, Str_LenType* offsets, Param_LenType size);
+Param_Result Param_get(const Param_Index* index, Param_LenType k, Param_Value* value);
+
+void Param_initTableCursor(Param_TableCursor* table, char* ptr, size_t len, char recordSeparator, char paramSeparator);
+Param_Cursor* Param_nextRow(Param_TableCursor* table, Param_Cursor* cursor);
+void Param_initColumns(Param_Columns* columns, Param_Column* column, Param_LenType len, uint32_t size);
+uint32_t Param_parseColumns(Param_TableCursor* table, Param_Columns* columns);
+
+void Param_initKeyValues(Param_KeyValues* keyValues, Param_KeyValue* params, Param_LenType size, uint8_t lazy);
+Param_LenType Param_parseKeyValues(Param_Cursor* cursor, Param_KeyValues* keyValues);
+Param* Param_find(Param_KeyValues* keyValues, const char* key);
+
+void Param_initStream(Param_Stream* stream, char* buffer, Str_LenType size, char paramSeparator, char lineEnd, Param_StreamFn onParam);
+Param_Result Param_feed(Param_Stream* stream, const char* chunk, Str_LenType len);
+Param_Result Param_flush(Param_Stream* stream);
+
 Str_LenType Param_toStr(char* str, Param_Value* values, Param_LenType len, char* separator);
+Str_LenType Param_toStrLen(Param_Value* values, Param_LenType len, const char* separator);
+Str_LenType Param_toStrN(char* str, Str_LenType size, Param_Value* values, Param_LenType len, const char* separator, Param_ToStrPos* pos);
 
 Str_LenType Param_valueToStr(char* str, Param_Value* value);
+Str_LenType Param_valueToStrLen(Param_Value* value);
 
 char Param_compareValue(Param_Value* a, Param_Value* b);
+uint32_t Param_hashValue(const Param_Value* value);
+int8_t Param_orderValue(const Param_Value* a, const Param_Value* b);
+void Param_sortKey(const Param_Value* value, Param_SortKey* key);
+
+#if PARAM_TYPE_ENUM
+    int16_t Param_registerEnum(const Param_EnumTable* table);
+    void Param_clearEnums(void);
+    const char* Param_enumName(Param_Enum value);
+#endif
+
+#if PARAM_STATS
+    void Param_statsSnapshot(Param_Stats* stats);
+    void Param_statsReset(void);
+#endif
 
 // ------------------------------------ Helper Functions --------------------------------------
+const char* Param_scan(const char* str, const char* end, char c1, char c2);
+
 Param_Result Param_parse(char* str, Param_Value* param);
 #if PARAM_TYPE_NUMBER_BINARY
     Param_Result Param_parseBinary(char* str, Param_Value* param);
@@ -262,6 +645,8 @@ Param_Result Param_parse(char* str, Param_Value* param);
 #endif
 Param_Result Param_parseUnknown(char* str, Param_Value* param);
 
+Param_Result Param_parseView(const char* str, Str_LenType len, Param_Value* param);
+
 
 
 #ifdef __cplusplus
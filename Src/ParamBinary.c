@@ -0,0 +1,390 @@
+/**
+ * @file ParamBinary.c
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Compact binary encoding of Param_Value arrays
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "ParamBinary.h"
+
+#if PARAM_BINARY
+
+#include <string.h>
+
+/**
+ * @brief maximum bytes of tag and scalar payload
+ */
+#define PARAM_BINARY_SCALAR_LEN     (1 + (sizeof(Param_UNumber) * 8 + 6) / 7)
+/**
+ * @brief maximum length of encoded values, limit of Str_LenType
+ */
+#define PARAM_BINARY_MAX_LEN        ((size_t)(((size_t) 1 << (sizeof(Str_LenType) * 8 - 1)) - 1))
+
+#define __zigzag(V)                 (((Param_UNumber) (V) << 1) ^ ((V) < 0 ? ~(Param_UNumber) 0 : 0))
+#define __unzigzag(U)               ((Param_Number) (((U) >> 1) ^ ((Param_UNumber) 0 - ((U) & 1))))
+
+static uint8_t* Param_writeVarint(uint8_t* p, Param_UNumber value) {
+    while (value >= 0x80) {
+        *p++ = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    *p++ = (uint8_t) value;
+    return p;
+}
+static uint8_t Param_varintLen(Param_UNumber value) {
+    uint8_t len = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        len++;
+    }
+    return len;
+}
+/**
+ * @brief read varint, reject truncated and overflowed values
+ *
+ * @return const uint8_t* next byte, or NULL if varint is not valid
+ */
+static const uint8_t* Param_readVarint(const uint8_t* p, const uint8_t* end, Param_UNumber* value) {
+    Param_UNumber num = 0;
+    uint8_t shift = 0;
+    uint8_t b;
+
+    while (p < end && shift < sizeof(num) * 8) {
+        b = *p++;
+        // last byte can not have more bits than number
+        if (sizeof(num) * 8 - shift < 7 && ((b & 0x7F) >> (sizeof(num) * 8 - shift)) != 0) {
+            return NULL;
+        }
+        num |= (Param_UNumber)(b & 0x7F) << shift;
+        if ((b & 0x80) == 0) {
+            *value = num;
+            return p;
+        }
+        shift += 7;
+    }
+    return NULL;
+}
+static uint8_t* Param_writeLE(uint8_t* p, Param_UNumber value, uint8_t len) {
+    while (len-- > 0) {
+        *p++ = (uint8_t) value;
+        value >>= 8;
+    }
+    return p;
+}
+static Param_UNumber Param_readLE(const uint8_t* p, uint8_t len) {
+    Param_UNumber value = 0;
+    while (len-- > 0) {
+        value = (value << 8) | p[len];
+    }
+    return value;
+}
+/**
+ * @brief return string of string family values and its length
+ *
+ * @return const char* string, or NULL if value is not in string family
+ */
+static const char* Param_binaryString(const Param_Value* value, size_t* len) {
+    switch (value->Type) {
+        case Param_ValueType_String:
+        case Param_ValueType_Null:
+        case Param_ValueType_Unknown:
+            *len = value->String != NULL ? strlen(value->String) : 0;
+            return value->String != NULL ? value->String : "";
+        case Param_ValueType_StringView:
+        case Param_ValueType_NullView:
+        case Param_ValueType_UnknownView:
+            *len = value->Len > 0 ? (size_t) value->Len : 0;
+            return value->StringView;
+        default:
+            return NULL;
+    }
+}
+/**
+ * @brief write scalar value, buffer must have PARAM_BINARY_SCALAR_LEN bytes
+ *
+ * @return uint8_t* next byte, or NULL if type is not supported
+ */
+static uint8_t* Param_writeScalar(uint8_t* p, const Param_Value* value) {
+#define __signedCase(TY) \
+    case Param_ValueType_ ##TY: \
+        return Param_writeVarint(p, __zigzag(value->TY))
+#define __unsignedCase(TY) \
+    case Param_ValueType_ ##TY: \
+        return Param_writeVarint(p, (Param_UNumber) value->TY)
+#define __byteCase(TY) \
+    case Param_ValueType_ ##TY: \
+        *p++ = value->TY; \
+        return p
+
+    uint32_t bits32;
+#if PARAM_TYPE_64BIT
+    uint64_t bits64;
+#endif
+
+    *p++ = (uint8_t) value->Type;
+    switch (value->Type) {
+        __signedCase(Number);
+        __signedCase(Int8);
+        __signedCase(Int16);
+        __signedCase(Int32);
+        __unsignedCase(UNumber);
+        __unsignedCase(NumberHex);
+        __unsignedCase(NumberBinary);
+        __unsignedCase(UInt8);
+        __unsignedCase(UInt16);
+        __unsignedCase(UInt32);
+    #if PARAM_TYPE_64BIT
+        __signedCase(Int64);
+        __unsignedCase(UInt64);
+    #endif
+        __byteCase(Boolean);
+        __byteCase(State);
+        __byteCase(StateKey);
+    #if PARAM_TYPE_ENUM
+        case Param_ValueType_Enum:
+            *p++ = value->Enum.Table;
+            *p++ = value->Enum.Ordinal;
+            return p;
+    #endif
+        case Param_ValueType_Float:
+            memcpy(&bits32, &value->Float, sizeof(bits32));
+            return Param_writeLE(p, bits32, sizeof(bits32));
+    #if PARAM_TYPE_64BIT
+        case Param_ValueType_Double:
+            memcpy(&bits64, &value->Double, sizeof(bits64));
+            return Param_writeLE(p, bits64, sizeof(bits64));
+    #endif
+        default:
+            return NULL;
+    }
+#undef __signedCase
+#undef __unsignedCase
+#undef __byteCase
+}
+/**
+ * @brief encode values to binary format
+ *
+ * @param buf
+ * @param size size of buf
+ * @param values
+ * @param len number of values
+ * @return Str_LenType number of bytes that written, or -1 if buf is small or a value type is not valid
+ */
+Str_LenType Param_toBinary(uint8_t* buf, Str_LenType size, const Param_Value* values, Param_LenType len) {
+    uint8_t scalar[PARAM_BINARY_SCALAR_LEN];
+    uint8_t* p = buf;
+    uint8_t* end = buf + (size > 0 ? size : 0);
+    uint8_t* pEnd;
+    const char* str;
+    size_t strLen;
+
+    while (len-- > 0) {
+        str = Param_binaryString(values, &strLen);
+        if (str != NULL) {
+            if (strLen > PARAM_BINARY_MAX_LEN || (size_t)(end - p) < 1 + Param_varintLen((Param_UNumber) strLen) + strLen + 1) {
+                return -1;
+            }
+            *p++ = (uint8_t) values->Type;
+            p = Param_writeVarint(p, (Param_UNumber) strLen);
+            memcpy(p, str, (size_t) strLen);
+            p += strLen;
+            *p++ = '\0';
+        }
+        else if (end - p >= (Str_LenType) PARAM_BINARY_SCALAR_LEN) {
+            p = Param_writeScalar(p, values);
+            if (p == NULL) {
+                return -1;
+            }
+        }
+        else {
+            // near end of buffer, write to temp and copy
+            pEnd = Param_writeScalar(scalar, values);
+            if (pEnd == NULL || end - p < pEnd - scalar) {
+                return -1;
+            }
+            memcpy(p, scalar, (size_t)(pEnd - scalar));
+            p += pEnd - scalar;
+        }
+        values++;
+    }
+
+    return (Str_LenType)(p - buf);
+}
+/**
+ * @brief return number of bytes that Param_toBinary need for values
+ *
+ * @param values
+ * @param len
+ * @return Str_LenType number of bytes, or -1 if a value type is not valid or length not fit in Str_LenType
+ */
+Str_LenType Param_toBinaryLen(const Param_Value* values, Param_LenType len) {
+    uint8_t scalar[PARAM_BINARY_SCALAR_LEN];
+    size_t total = 0;
+    size_t strLen;
+    uint8_t* pEnd;
+
+    while (len-- > 0) {
+        if (Param_binaryString(values, &strLen) != NULL) {
+            if (strLen > PARAM_BINARY_MAX_LEN) {
+                return -1;
+            }
+            total += 1 + Param_varintLen((Param_UNumber) strLen) + strLen + 1;
+        }
+        else {
+            pEnd = Param_writeScalar(scalar, values);
+            if (pEnd == NULL) {
+                return -1;
+            }
+            total += (size_t)(pEnd - scalar);
+        }
+        if (total > PARAM_BINARY_MAX_LEN) {
+            return -1;
+        }
+        values++;
+    }
+
+    return (Str_LenType) total;
+}
+/**
+ * @brief decode values of binary format, strings point into buf without copy
+ * and buf must be valid while values are used
+ *
+ * @param buf
+ * @param len length of buf
+ * @param values
+ * @param size maximum number of values
+ * @return Param_LenType number of decoded values, or -1 if buf is not valid, ex: Boolean value that is not 0 or 1
+ */
+Param_LenType Param_fromBinary(const uint8_t* buf, Str_LenType len, Param_Value* values, Param_LenType size) {
+#define __signedCase(TY, MIN, MAX) \
+    case Param_ValueType_ ##TY: \
+        if (__unzigzag(num) < (MIN) || __unzigzag(num) > (MAX)) { \
+            return -1; \
+        } \
+        values->TY = (PARAM_VALUETYPE(TY)) __unzigzag(num); \
+        break
+#define __unsignedCase(TY, MAX) \
+    case Param_ValueType_ ##TY: \
+        if (num > (MAX)) { \
+            return -1; \
+        } \
+        values->TY = (PARAM_VALUETYPE(TY)) num; \
+        break
+
+    const uint8_t* p = buf;
+    const uint8_t* end = buf + len;
+    Param_LenType count = 0;
+    Param_UNumber num;
+    uint32_t bits32;
+#if PARAM_TYPE_64BIT
+    uint64_t bits64;
+#endif
+
+    while (p < end && count < size) {
+        values->Type = (Param_ValueType) *p++;
+        switch (values->Type) {
+            case Param_ValueType_Number:
+            case Param_ValueType_Int8:
+            case Param_ValueType_Int16:
+            case Param_ValueType_Int32:
+        #if PARAM_TYPE_64BIT
+            case Param_ValueType_Int64:
+            case Param_ValueType_UInt64:
+        #endif
+            case Param_ValueType_UNumber:
+            case Param_ValueType_NumberHex:
+            case Param_ValueType_NumberBinary:
+            case Param_ValueType_UInt8:
+            case Param_ValueType_UInt16:
+            case Param_ValueType_UInt32:
+                p = Param_readVarint(p, end, &num);
+                if (p == NULL) {
+                    return -1;
+                }
+                switch (values->Type) {
+                    __signedCase(Int8, INT8_MIN, INT8_MAX);
+                    __signedCase(Int16, INT16_MIN, INT16_MAX);
+                    __signedCase(Int32, INT32_MIN, INT32_MAX);
+                #if PARAM_TYPE_64BIT
+                    __signedCase(Int64, INT64_MIN, INT64_MAX);
+                    __unsignedCase(UInt64, UINT64_MAX);
+                #endif
+                    __unsignedCase(UInt8, UINT8_MAX);
+                    __unsignedCase(UInt16, UINT16_MAX);
+                    __unsignedCase(UInt32, UINT32_MAX);
+                    case Param_ValueType_Number:
+                        values->Number = __unzigzag(num);
+                        break;
+                    default:
+                        // UNumber, NumberHex and NumberBinary share same field
+                        values->UNumber = num;
+                        break;
+                }
+                break;
+            case Param_ValueType_Boolean:
+            case Param_ValueType_State:
+            case Param_ValueType_StateKey:
+                // only 0 and 1 are valid
+                if (p >= end || *p > 1) {
+                    return -1;
+                }
+                values->Boolean = *p++;
+                break;
+        #if PARAM_TYPE_ENUM
+            case Param_ValueType_Enum:
+                if (end - p < 2) {
+                    return -1;
+                }
+                values->Enum.Table = *p++;
+                values->Enum.Ordinal = *p++;
+                break;
+        #endif
+            case Param_ValueType_Float:
+                if (end - p < (Str_LenType) sizeof(bits32)) {
+                    return -1;
+                }
+                bits32 = (uint32_t) Param_readLE(p, sizeof(bits32));
+                memcpy(&values->Float, &bits32, sizeof(bits32));
+                p += sizeof(bits32);
+                break;
+        #if PARAM_TYPE_64BIT
+            case Param_ValueType_Double:
+                if (end - p < (Str_LenType) sizeof(bits64)) {
+                    return -1;
+                }
+                bits64 = (uint64_t) Param_readLE(p, sizeof(bits64));
+                memcpy(&values->Double, &bits64, sizeof(bits64));
+                p += sizeof(bits64);
+                break;
+        #endif
+            case Param_ValueType_String:
+            case Param_ValueType_Null:
+            case Param_ValueType_Unknown:
+            case Param_ValueType_StringView:
+            case Param_ValueType_NullView:
+            case Param_ValueType_UnknownView:
+                p = Param_readVarint(p, end, &num);
+                // string and its null terminator
+                if (p == NULL || num >= (Param_UNumber)(end - p) || p[num] != '\0') {
+                    return -1;
+                }
+                values->String = (char*) p;
+                values->Len = (Str_LenType) num;
+                p += num + 1;
+                break;
+            default:
+                return -1;
+        }
+        values++;
+        count++;
+    }
+
+    return count;
+#undef __signedCase
+#undef __unsignedCase
+}
+
+#endif // PARAM_BINARY
@@ -0,0 +1,42 @@
+/**
+ * @file ParamBinary.h
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Compact binary encoding of Param_Value arrays
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _PARAM_BINARY_H_
+#define _PARAM_BINARY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "Param.h"
+
+#if PARAM_BINARY
+
+/**
+ * Encoding of each value, one byte Param_ValueType tag and then payload:
+ * - signed integers: zigzag varint
+ * - unsigned integers, hex and binary: varint
+ * - Boolean, State, StateKey: one byte
+ * - Enum: table and ordinal bytes
+ * - Float, Double: raw IEEE-754 in little-endian
+ * - String, Null, Unknown and views: varint length, bytes and null terminator
+ */
+
+Str_LenType Param_toBinary(uint8_t* buf, Str_LenType size, const Param_Value* values, Param_LenType len);
+Str_LenType Param_toBinaryLen(const Param_Value* values, Param_LenType len);
+Param_LenType Param_fromBinary(const uint8_t* buf, Str_LenType len, Param_Value* values, Param_LenType size);
+
+#endif // PARAM_BINARY
+
+#ifdef __cplusplus
+};
+#endif /* __cplusplus */
+
+#endif // _PARAM_BINARY_H_
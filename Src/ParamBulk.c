@@ -0,0 +1,377 @@
+/**
+ * @file ParamBulk.c
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Multi-threaded parser for buffers with many records
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "ParamBulk.h"
+
+#if __PARAM_BULK
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/**
+ * @brief maximum number of worker threads
+ */
+#define PARAM_BULK_MAX_THREADS          64
+/**
+ * @brief maximum params of a record, limit of Param_LenType
+ */
+#define PARAM_BULK_MAX_PARAMS           0x7FFF
+
+/**
+ * @brief records of a chunk, chunk start and end on record boundaries
+ */
+typedef struct {
+    char*               Start;
+    char*               End;
+    size_t              RecordsLen;
+    size_t              ParamsLen;
+    size_t              FirstRecord;    /**< global number of first record, fill after first phase */
+    size_t              FirstParam;     /**< global offset of first param, fill after first phase */
+    Param_Result        Result;
+} Param_BulkChunk;
+/**
+ * @brief chunks of a worker, owner take chunks from head and other workers steal from tail
+ */
+typedef struct {
+    size_t              Head;
+    size_t              Tail;
+    pthread_mutex_t     Lock;
+} Param_BulkQueue;
+/**
+ * @brief shared state of workers, each worker start on its own range of chunks
+ * and after that steal chunks from other workers, so a thread that get short lines just take more chunks
+ */
+typedef struct {
+    Param_BulkChunk*    Chunks;
+    size_t              Len;
+    Param_BulkQueue     Queues[PARAM_BULK_MAX_THREADS];
+    uint8_t             Threads;
+    char                ParamSeparator;
+    char                RecordSeparator;
+    Param_Records*      Out;
+    void (*Job)(void* bulk, Param_BulkChunk* chunk);
+} Param_Bulk;
+/**
+ * @brief argument of worker thread
+ */
+typedef struct {
+    Param_Bulk*         Bulk;
+    uint8_t             Id;
+} Param_BulkWorker;
+
+/**
+ * @brief grow array to hold at least one more item
+ *
+ * @param arr
+ * @param size current capacity in items
+ * @param item size of each item
+ * @return uint8_t 0 if out of memory
+ */
+static uint8_t Param_bulkGrow(void** arr, size_t* size, size_t item) {
+    size_t newSize = *size ? *size * 2 : 64;
+    void* newArr = realloc(*arr, newSize * item);
+    if (newArr == NULL) {
+        return 0;
+    }
+    *arr = newArr;
+    *size = newSize;
+    return 1;
+}
+/**
+ * @brief take a chunk of queue
+ *
+ * @param queue
+ * @param steal take from tail instead of head
+ * @param index
+ * @return uint8_t 0 if queue is empty
+ */
+static uint8_t Param_bulkTake(Param_BulkQueue* queue, uint8_t steal, size_t* index) {
+    uint8_t found = 0;
+
+    pthread_mutex_lock(&queue->Lock);
+    if (queue->Head < queue->Tail) {
+        *index = steal ? --queue->Tail : queue->Head++;
+        found = 1;
+    }
+    pthread_mutex_unlock(&queue->Lock);
+    return found;
+}
+static void* Param_bulkWorker(void* args) {
+    Param_BulkWorker* worker = (Param_BulkWorker*) args;
+    Param_Bulk* bulk = worker->Bulk;
+    size_t index;
+    uint8_t found;
+    uint8_t i;
+
+    for (;;) {
+        found = Param_bulkTake(&bulk->Queues[worker->Id], 0, &index);
+        // queues never refill, so worker is done when all of them are empty
+        for (i = 1; !found && i < bulk->Threads; i++) {
+            found = Param_bulkTake(&bulk->Queues[(worker->Id + i) % bulk->Threads], 1, &index);
+        }
+        if (!found) {
+            break;
+        }
+        bulk->Job(bulk, &bulk->Chunks[index]);
+    }
+    return NULL;
+}
+/**
+ * @brief run job of bulk on all chunks with given number of threads, caller thread is one of workers
+ * chunks of a thread that failed to start are stolen by others
+ *
+ * @param bulk
+ * @param threads
+ * @return Param_Result Param_Error if queues can not initialize
+ */
+static Param_Result Param_bulkRun(Param_Bulk* bulk, uint8_t threads) {
+    pthread_t workers[PARAM_BULK_MAX_THREADS];
+    Param_BulkWorker args[PARAM_BULK_MAX_THREADS];
+    uint8_t started[PARAM_BULK_MAX_THREADS];
+    uint8_t i;
+
+    bulk->Threads = (size_t) threads < bulk->Len ? threads : (uint8_t) bulk->Len;
+    for (i = 0; i < bulk->Threads; i++) {
+        bulk->Queues[i].Head = bulk->Len * i / bulk->Threads;
+        bulk->Queues[i].Tail = bulk->Len * (i + 1) / bulk->Threads;
+        if (pthread_mutex_init(&bulk->Queues[i].Lock, NULL) != 0) {
+            while (i > 0) {
+                pthread_mutex_destroy(&bulk->Queues[--i].Lock);
+            }
+            return Param_Error;
+        }
+        args[i].Bulk = bulk;
+        args[i].Id = i;
+    }
+    for (i = 1; i < bulk->Threads; i++) {
+        started[i] = pthread_create(&workers[i], NULL, Param_bulkWorker, &args[i]) == 0;
+    }
+    if (bulk->Threads > 0) {
+        Param_bulkWorker(&args[0]);
+    }
+    for (i = 1; i < bulk->Threads; i++) {
+        if (started[i]) {
+            pthread_join(workers[i], NULL);
+        }
+    }
+    for (i = 0; i < bulk->Threads; i++) {
+        pthread_mutex_destroy(&bulk->Queues[i].Lock);
+    }
+    return Param_Ok;
+}
+/**
+ * @brief length of cursor for record, records longer than cursor length continue up to null terminator
+ *
+ * @param len length of record
+ * @return Str_LenType
+ */
+static Str_LenType Param_bulkCursorLen(size_t len) {
+    Str_LenType cursorLen = (Str_LenType) len;
+    return (size_t) cursorLen == len ? cursorLen : 0;
+}
+/**
+ * @brief number of params that Param_parseAll return for record, without touch it
+ * empty record has no param and separator at end of record don't start a new param
+ *
+ * @param str
+ * @param end end of record
+ * @param paramSeparator
+ * @return size_t
+ */
+static size_t Param_bulkRecordParams(const char* str, const char* end, char paramSeparator) {
+    const char* pStr;
+    size_t count = 1;
+
+    if (str == end) {
+        return 0;
+    }
+    for (pStr = str; pStr < end; pStr++) {
+        count += *pStr == paramSeparator;
+    }
+    if (end[-1] == paramSeparator) {
+        count--;
+    }
+    return count;
+}
+/**
+ * @brief first phase, count records and params of chunk to find place of them in final arrays
+ *
+ * @param args
+ * @param chunk
+ */
+static void Param_bulkCount(void* args, Param_BulkChunk* chunk) {
+    Param_Bulk* bulk = (Param_Bulk*) args;
+    const char* pStr = chunk->Start;
+    const char* pEnd;
+    size_t params;
+
+    chunk->Result = Param_Ok;
+    while (pStr < chunk->End) {
+        pEnd = (const char*) memchr(pStr, bulk->RecordSeparator, (size_t)(chunk->End - pStr));
+        if (pEnd == NULL) {
+            pEnd = chunk->End;
+        }
+        params = Param_bulkRecordParams(pStr, pEnd, bulk->ParamSeparator);
+        if (params > PARAM_BULK_MAX_PARAMS) {
+            chunk->Result = Param_Error;
+            return;
+        }
+        chunk->RecordsLen++;
+        chunk->ParamsLen += params;
+        pStr = pEnd + 1;
+    }
+}
+/**
+ * @brief second phase, parse records of chunk in place directly into their final slots,
+ * record separators replace with null terminator
+ *
+ * @param args
+ * @param chunk
+ */
+static void Param_bulkParse(void* args, Param_BulkChunk* chunk) {
+    Param_Bulk* bulk = (Param_Bulk*) args;
+    Param* params = &bulk->Out->Params[chunk->FirstParam];
+    Param* paramsEnd = params + chunk->ParamsLen;
+    Param_Record* record = &bulk->Out->Records[chunk->FirstRecord];
+    Param_Cursor cursor;
+    size_t space;
+    char* pStr = chunk->Start;
+    char* pEnd;
+
+    chunk->Result = Param_Ok;
+    while (pStr < chunk->End) {
+        pEnd = (char*) memchr(pStr, bulk->RecordSeparator, (size_t)(chunk->End - pStr));
+        if (pEnd == NULL) {
+            pEnd = chunk->End;
+        }
+        *pEnd = '\0';
+        Param_initCursor(&cursor, pStr, Param_bulkCursorLen((size_t)(pEnd - pStr)), bulk->ParamSeparator);
+        space = (size_t)(paramsEnd - params);
+        record->Params = params;
+        record->Number = chunk->FirstRecord + (size_t)(record - &bulk->Out->Records[chunk->FirstRecord]);
+        record->Len = Param_parseAll(&cursor, params, (Param_LenType)(space < PARAM_BULK_MAX_PARAMS ? space : PARAM_BULK_MAX_PARAMS));
+        params += record->Len;
+        // params that not counted, ex: null character inside of record
+        if (cursor.Ptr != NULL && (*cursor.Ptr != '\0' || cursor.Len != 0)) {
+            chunk->Result = Param_Error;
+            return;
+        }
+        record++;
+        pStr = pEnd + 1;
+    }
+    if (params != paramsEnd) {
+        chunk->Result = Param_Error;
+    }
+}
+/**
+ * @brief parse all records of buffer with multiple threads, buffer split to chunks on record boundaries,
+ * first phase count records and params of each chunk and second phase parse each chunk directly into
+ * its place of final arrays, workers start on own range of chunks and steal chunks of others when done.
+ * result records are in order of input with global record numbers.
+ * buffer modify in place and must be null terminated, string params point into buffer
+ *
+ * @param buffer
+ * @param len length of buffer
+ * @param recordSeparator ex: '\n'
+ * @param paramSeparator ex: ','
+ * @param threads number of threads, 0 for number of online processors
+ * @param records result, free with Param_freeRecords
+ * @return Param_Result Param_Error if out of memory or a record has more params than Param_LenType can hold
+ */
+Param_Result Param_parseBulk(char* buffer, size_t len, char recordSeparator, char paramSeparator, uint8_t threads, Param_Records* records) {
+    Param_Bulk bulk;
+    Param_Result res = Param_Ok;
+    char* pStr = buffer;
+    char* pEnd = buffer + len;
+    char* pSep;
+    size_t size = 0;
+    size_t i;
+
+    memset(records, 0, sizeof(Param_Records));
+    memset(&bulk, 0, sizeof(bulk));
+    bulk.ParamSeparator = paramSeparator;
+    bulk.RecordSeparator = recordSeparator;
+    bulk.Out = records;
+    if (threads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (uint8_t)(cpus < 1 ? 1 : cpus > PARAM_BULK_MAX_THREADS ? PARAM_BULK_MAX_THREADS : cpus);
+    }
+    else if (threads > PARAM_BULK_MAX_THREADS) {
+        threads = PARAM_BULK_MAX_THREADS;
+    }
+    // split buffer before parsing, workers replace separators with null terminator
+    while (pStr < pEnd) {
+        if (bulk.Len == size &&
+            !Param_bulkGrow((void**) &bulk.Chunks, &size, sizeof(Param_BulkChunk))) {
+            free(bulk.Chunks);
+            return Param_Error;
+        }
+        memset(&bulk.Chunks[bulk.Len], 0, sizeof(Param_BulkChunk));
+        bulk.Chunks[bulk.Len].Start = pStr;
+        if ((size_t)(pEnd - pStr) > PARAM_BULK_CHUNK_SIZE) {
+            pStr += PARAM_BULK_CHUNK_SIZE - 1;
+            pSep = (char*) memchr(pStr, recordSeparator, (size_t)(pEnd - pStr));
+            pStr = pSep != NULL ? pSep + 1 : pEnd;
+        }
+        else {
+            pStr = pEnd;
+        }
+        bulk.Chunks[bulk.Len++].End = pStr;
+    }
+    // first phase: count records and params of chunks
+    bulk.Job = Param_bulkCount;
+    res = Param_bulkRun(&bulk, threads);
+    // global numbers
+    for (i = 0; i < bulk.Len; i++) {
+        if (bulk.Chunks[i].Result != Param_Ok) {
+            res = Param_Error;
+        }
+        bulk.Chunks[i].FirstRecord = records->Len;
+        bulk.Chunks[i].FirstParam = records->ParamsLen;
+        records->Len += bulk.Chunks[i].RecordsLen;
+        records->ParamsLen += bulk.Chunks[i].ParamsLen;
+    }
+    // second phase: parse chunks into final arrays
+    if (res == Param_Ok && records->Len > 0) {
+        records->Records = (Param_Record*) malloc(records->Len * sizeof(Param_Record));
+        records->Params = (Param*) malloc((records->ParamsLen ? records->ParamsLen : 1) * sizeof(Param));
+        if (records->Records != NULL && records->Params != NULL) {
+            bulk.Job = Param_bulkParse;
+            res = Param_bulkRun(&bulk, threads);
+            for (i = 0; i < bulk.Len; i++) {
+                if (bulk.Chunks[i].Result != Param_Ok) {
+                    res = Param_Error;
+                }
+            }
+        }
+        else {
+            res = Param_Error;
+        }
+    }
+    free(bulk.Chunks);
+    if (res != Param_Ok) {
+        Param_freeRecords(records);
+    }
+    return res;
+}
+/**
+ * @brief free memory of records that returned by Param_parseBulk
+ *
+ * @param records
+ */
+void Param_freeRecords(Param_Records* records) {
+    free(records->Records);
+    free(records->Params);
+    memset(records, 0, sizeof(Param_Records));
+}
+
+#endif // __PARAM_BULK
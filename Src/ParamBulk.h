@@ -0,0 +1,59 @@
+/**
+ * @file ParamBulk.h
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Multi-threaded parser for buffers with many records
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _PARAM_BULK_H_
+#define _PARAM_BULK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "Param.h"
+
+#if PARAM_BULK && (defined(__unix__) || defined(__APPLE__))
+    #define __PARAM_BULK        1
+#else
+    #define __PARAM_BULK        0
+#endif
+
+#if __PARAM_BULK
+
+/**
+ * @brief params of a record
+ */
+typedef struct {
+    Param*              Params;
+    Param_LenType       Len;
+    size_t              Number;     /**< global record number, 0 for first record of buffer */
+} Param_Record;
+/**
+ * @brief result of bulk parser, records are in order of input
+ */
+typedef struct {
+    Param_Record*       Records;
+    size_t              Len;
+    Param*              Params;     /**< params of all records */
+    size_t              ParamsLen;
+} Param_Records;
+
+/**
+ * @brief each worker own a queue of chunks and steal from tail of other queues when its queue is empty,
+ * params parse directly into Params of result, a record with more than 0x7FFF params return Param_Error
+ */
+Param_Result Param_parseBulk(char* buffer, size_t len, char recordSeparator, char paramSeparator, uint8_t threads, Param_Records* records);
+void Param_freeRecords(Param_Records* records);
+
+#endif // __PARAM_BULK
+
+#ifdef __cplusplus
+};
+#endif /* __cplusplus */
+
+#endif // _PARAM_BULK_H_
@@ -0,0 +1,54 @@
+/**
+ * @file ParamConvert.h
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Number conversion engines of Param library
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _PARAM_CONVERT_H_
+#define _PARAM_CONVERT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "Param.h"
+
+/**
+ * @brief decimal number that scanned by parser, value = Mantissa * 10^Exponent
+ */
+typedef struct {
+    const char*         Str;        /**< digits of number, without sign and suffix, use by slow path */
+    uint64_t            Mantissa;   /**< first significant digits */
+    int32_t             Exponent;   /**< decimal exponent of Mantissa */
+    Str_LenType         Len;        /**< length of Str */
+    uint8_t             Negative;
+    uint8_t             Truncated;  /**< Str has non zero digits that not fit in Mantissa */
+} Param_Decimal;
+
+float Param_decimalToFloat(const Param_Decimal* dec);
+#if PARAM_TYPE_64BIT
+    double Param_decimalToDouble(const Param_Decimal* dec);
+#endif
+
+Str_LenType Param_unumberLen(Param_UNumber value);
+Str_LenType Param_hexLen(Param_UNumber value);
+Str_LenType Param_binaryLen(Param_UNumber value);
+Str_LenType Param_unumberToStr(char* str, Param_UNumber value);
+Str_LenType Param_numberToStr(char* str, Param_Number value);
+Str_LenType Param_hexToStr(char* str, Param_UNumber value);
+Str_LenType Param_binaryToStr(char* str, Param_UNumber value);
+
+Str_LenType Param_floatToStr(char* str, float value);
+#if PARAM_TYPE_64BIT
+    Str_LenType Param_doubleToStr(char* str, double value);
+#endif
+
+#ifdef __cplusplus
+};
+#endif /* __cplusplus */
+
+#endif // _PARAM_CONVERT_H_
@@ -0,0 +1,134 @@
+/**
+ * @file ParamFile.c
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Read records of a file with memory mapping
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#if !defined(_POSIX_C_SOURCE) && !defined(_GNU_SOURCE)
+    #define _POSIX_C_SOURCE     200112L
+#endif
+#include "ParamFile.h"
+
+#if __PARAM_FILE
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * @brief maximum length of record that a cursor can hold
+ */
+#define PARAM_FILE_MAX_RECORD       ((size_t)(((size_t) 1 << (sizeof(Str_LenType) * 8 - 1)) - 1))
+
+/**
+ * @brief map file for reading records, mapping is lazy so open cost not depend on file size,
+ * pages that read once stay in page cache for next runs
+ *
+ * @param file
+ * @param path
+ * @param recordSeparator ex: '\n'
+ * @param paramSeparator ex: ','
+ * @return Param_Result Param_Error if file can not open or map
+ */
+Param_Result Param_openFile(Param_File* file, const char* path, char recordSeparator, char paramSeparator) {
+    struct stat st;
+    void* data;
+    int fd;
+
+    memset(file, 0, sizeof(Param_File));
+    file->RecordSeparator = recordSeparator;
+    file->ParamSeparator = paramSeparator;
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return Param_Error;
+    }
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return Param_Error;
+    }
+    // empty file has no mapping
+    if (st.st_size > 0) {
+        data = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            close(fd);
+            return Param_Error;
+        }
+        posix_madvise(data, (size_t) st.st_size, POSIX_MADV_SEQUENTIAL);
+        file->Data = (const char*) data;
+        file->Size = (size_t) st.st_size;
+    }
+    // mapping stay valid after close
+    close(fd);
+    return Param_Ok;
+}
+/**
+ * @brief unmap file, cursors and view params of file are invalid after close
+ *
+ * @param file
+ */
+void Param_closeFile(Param_File* file) {
+    if (file->Data != NULL) {
+        munmap((void*) file->Data, file->Size);
+    }
+    memset(file, 0, sizeof(Param_File));
+}
+/**
+ * @brief initialize cursor on next record of file, use cursor with Param_nextView
+ * record separator of last record is optional, a record longer than cursor length is cut on
+ * last param separator that fit in cursor and Truncated flag of file is set
+ *
+ * @param file
+ * @param cursor
+ * @return Param_Cursor* return cursor, or NULL if there is no more records
+ */
+Param_Cursor* Param_nextRecord(Param_File* file, Param_Cursor* cursor) {
+    const char* pStr;
+    const char* pEnd;
+    size_t len;
+
+    if (file->Pos >= file->Size) {
+        return NULL;
+    }
+    pStr = file->Data + file->Pos;
+    pEnd = (const char*) memchr(pStr, file->RecordSeparator, file->Size - file->Pos);
+    if (pEnd == NULL) {
+        pEnd = file->Data + file->Size;
+        file->Pos = file->Size;
+    }
+    else {
+        file->Pos = (size_t)(pEnd - file->Data) + 1;
+    }
+    len = (size_t)(pEnd - pStr);
+    file->Record++;
+    file->Truncated = len > PARAM_FILE_MAX_RECORD;
+    if (file->Truncated) {
+        // keep whole params if possible
+        len = PARAM_FILE_MAX_RECORD;
+        while (len > 0 && pStr[len] != file->ParamSeparator) {
+            len--;
+        }
+        if (len == 0) {
+            len = PARAM_FILE_MAX_RECORD;
+        }
+    }
+    Param_initCursorView(cursor, pStr, (Str_LenType) len, file->ParamSeparator);
+    return cursor;
+}
+/**
+ * @brief start reading file from first record again
+ *
+ * @param file
+ */
+void Param_rewindFile(Param_File* file) {
+    file->Pos = 0;
+    file->Record = 0;
+    file->Truncated = 0;
+}
+
+#endif // __PARAM_FILE
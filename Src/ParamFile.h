@@ -0,0 +1,52 @@
+/**
+ * @file ParamFile.h
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Read records of a file with memory mapping
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _PARAM_FILE_H_
+#define _PARAM_FILE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "Param.h"
+
+#if PARAM_FILE && (defined(__unix__) || defined(__APPLE__))
+    #define __PARAM_FILE        1
+#else
+    #define __PARAM_FILE        0
+#endif
+
+#if __PARAM_FILE
+
+/**
+ * @brief read-only mapping of a file, records parse in view mode so pages stay shared with page cache
+ */
+typedef struct {
+    const char*         Data;
+    size_t              Size;
+    size_t              Pos;        /**< offset of next record */
+    size_t              Record;     /**< number of records that read, current record number is Record - 1 */
+    uint8_t             Truncated;  /**< current record is longer than cursor length, cursor hold only first part of it */
+    char                RecordSeparator;
+    char                ParamSeparator;
+} Param_File;
+
+Param_Result Param_openFile(Param_File* file, const char* path, char recordSeparator, char paramSeparator);
+void Param_closeFile(Param_File* file);
+Param_Cursor* Param_nextRecord(Param_File* file, Param_Cursor* cursor);
+void Param_rewindFile(Param_File* file);
+
+#endif // __PARAM_FILE
+
+#ifdef __cplusplus
+};
+#endif /* __cplusplus */
+
+#endif // _PARAM_FILE_H_
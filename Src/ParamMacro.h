@@ -186,6 +186,60 @@
 #endif // PARAM_SYSTEM_BYTE_ORDER == PARAM_SYSTEM_BYTE_ORDER_AU
 // ----------------------------------------------------------------------------------------------------------
 
+// ------------------------------------------- Detect SIMD Instructions -------------------------------------
+#define PARAM_SIMD_NONE                             0
+#define PARAM_SIMD_SSE2                             1
+#define PARAM_SIMD_AVX2                             2
+#define PARAM_SIMD_NEON                             3
+
+#if PARAM_SCAN_MODE == PARAM_SCAN_SIMD
+    #if defined(__AVX2__)
+        #define PARAM_SIMD                          PARAM_SIMD_AVX2
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define PARAM_SIMD                          PARAM_SIMD_SSE2
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define PARAM_SIMD                          PARAM_SIMD_NEON
+    #endif
+#endif
+
+#if !defined(PARAM_SIMD)
+    #define PARAM_SIMD                              PARAM_SIMD_NONE
+#endif
+
+// ------------------------------------------- Count Trailing Zeros -----------------------------------------
+#if defined(__GNUC__) || defined(__clang__)
+    #define PARAM_CTZ32(X)                          __builtin_ctz((X))
+    #define PARAM_CTZ64(X)                          __builtin_ctzll((X))
+#else
+    static inline int __Param_ctz64(uint64_t x) {
+        int n = 0;
+        while ((x & 1) == 0) {
+            x >>= 1;
+            n++;
+        }
+        return n;
+    }
+    #define PARAM_CTZ32(X)                          __Param_ctz64((uint64_t)(X))
+    #define PARAM_CTZ64(X)                          __Param_ctz64((X))
+#endif
+// ------------------------------------------- Count Leading Zeros ------------------------------------------
+#if defined(__GNUC__) || defined(__clang__)
+    #define PARAM_CLZ32(X)                          __builtin_clz((X))
+    #define PARAM_CLZ64(X)                          __builtin_clzll((X))
+#else
+    static inline int __Param_clz64(uint64_t x) {
+        int n = 0;
+        while ((x & 0x8000000000000000ULL) == 0) {
+            x <<= 1;
+            n++;
+        }
+        return n;
+    }
+    #define PARAM_CLZ32(X)                          (__Param_clz64((uint64_t)(X)) - 32)
+    #define PARAM_CLZ64(X)                          __Param_clz64((X))
+#endif
+// ----------------------------------------------------------------------------------------------------------
+
 #define PARAM_CHECK_CATEGORY(P, T)                  __PARAM_CHECK_CATEGORY_(P, T)
 #define __PARAM_CHECK_CATEGORY_(P, T)               __PARAM_CHECK_CATEGORY__(P, T)
 #define __PARAM_CHECK_CATEGORY__(P, T)              (((P)->Value.Type & Param_Category_Mask) == Param_Category_ ##T)
@@ -194,6 +248,12 @@
 #define __PARAM_CHECK_VALUETYPE_(P, T)              __PARAM_CHECK_VALUETYPE__(P, T)
 #define __PARAM_CHECK_VALUETYPE__(P, T)             (((P)->Value.Type & Param_Category_Mask) == (Param_ValueType_ ##T & Param_Category_Mask))
 
+#define PARAM_FIELD(TYPE, STRUCT, MEMBER)           { Param_ValueType_ ##TYPE, (uint16_t) offsetof(STRUCT, MEMBER) }
+#define PARAM_COLUMN(TYPE, VALUES, VALID)           { (void*) (VALUES), (VALID), Param_ValueType_ ##TYPE, (uint8_t) sizeof(PARAM_VALUETYPE(TYPE)) }
+
+#define PARAM_ENUM_TABLE(NAME, ...)                 static const char* const NAME ##_Names[] = { __VA_ARGS__ }; \
+                                                    static const Param_EnumTable NAME = { NAME ##_Names, (uint8_t)(sizeof(NAME ##_Names) / sizeof(NAME ##_Names[0])) }
+
 #define PARAM_VALUETYPE(NAME)                       __PARAM_VALUETYPE_(NAME)
 #define __PARAM_VALUETYPE_(NAME)                    __PARAM_VALUETYPE__(NAME)
 #define __PARAM_VALUETYPE__(NAME)                   __PARAM_VALUETYPE_ ##NAME
@@ -227,7 +287,11 @@
 #define __PARAM_VALUETYPE_STATE                     uint8_t
 #define __PARAM_VALUETYPE_STATEKEY                  uint8_t
 #define __PARAM_VALUETYPE_BOOLEAN                   uint8_t
+#define __PARAM_VALUETYPE_ENUM                      Param_Enum
 #define __PARAM_VALUETYPE_STRING                    char*
+#define __PARAM_VALUETYPE_STRINGVIEW                const char*
+#define __PARAM_VALUETYPE_NULLVIEW                  const char*
+#define __PARAM_VALUETYPE_UNKNOWNVIEW               const char*
 
 #define __PARAM_VALUETYPE_Unknown                   __PARAM_VALUETYPE_UNKNOWN
 #define __PARAM_VALUETYPE_Null                      __PARAM_VALUETYPE_NULL
@@ -248,6 +312,10 @@
 #define __PARAM_VALUETYPE_State                     __PARAM_VALUETYPE_STATE
 #define __PARAM_VALUETYPE_StateKey                  __PARAM_VALUETYPE_STATEKEY
 #define __PARAM_VALUETYPE_Boolean                   __PARAM_VALUETYPE_BOOLEAN
+#define __PARAM_VALUETYPE_Enum                      __PARAM_VALUETYPE_ENUM
 #define __PARAM_VALUETYPE_String                    __PARAM_VALUETYPE_STRING
+#define __PARAM_VALUETYPE_StringView                __PARAM_VALUETYPE_STRINGVIEW
+#define __PARAM_VALUETYPE_NullView                  __PARAM_VALUETYPE_NULLVIEW
+#define __PARAM_VALUETYPE_UnknownView               __PARAM_VALUETYPE_UNKNOWNVIEW
 
 #endif // _PARAM_MACO_H_
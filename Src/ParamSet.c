@@ -0,0 +1,213 @@
+/**
+ * @file ParamSet.c
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Hash set and hash map of Param_Value
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "ParamSet.h"
+
+#if PARAM_VALUE_SET
+
+#include <string.h>
+
+/**
+ * @brief initialize value set, size round down to power of 2
+ * and set keep a quarter of entries empty for short probes
+ *
+ * @param set
+ * @param entries
+ * @param size size of entries
+ * @param arena storage of strings, can be NULL
+ * @param arenaSize size of arena
+ */
+void Param_initValueSet(Param_ValueSet* set, Param_ValueEntry* entries, uint32_t size, char* arena, uint32_t arenaSize) {
+    while ((size & (size - 1)) != 0) {
+        size &= size - 1;
+    }
+    set->Entries = entries;
+    set->Size = size;
+    set->Arena = arena;
+    set->ArenaSize = arenaSize;
+    Param_clearValueSet(set);
+}
+/**
+ * @brief remove all values of set
+ *
+ * @param set
+ */
+void Param_clearValueSet(Param_ValueSet* set) {
+    memset(set->Entries, 0, set->Size * sizeof(Param_ValueEntry));
+    set->Len = 0;
+    set->ArenaLen = 0;
+}
+/**
+ * @brief find entry of value or empty entry that value must be there
+ *
+ * @param set
+ * @param value
+ * @param hash
+ * @return Param_ValueEntry*
+ */
+static Param_ValueEntry* Param_findEntry(Param_ValueSet* set, Param_Value* value, uint32_t hash) {
+    Param_ValueEntry* entry;
+    uint32_t index = hash & (set->Size - 1);
+
+    for (;;) {
+        entry = &set->Entries[index];
+        if (entry->Count == 0 || (entry->Hash == hash && Param_compareValue(&entry->Value, value))) {
+            return entry;
+        }
+        index = (index + 1) & (set->Size - 1);
+    }
+}
+/**
+ * @brief copy string of value to arena, views keep their type and Len
+ * so lookups with same view still match, copy is null terminated too
+ *
+ * @param set
+ * @param value
+ * @return Param_Result Param_Error if arena is full
+ */
+static Param_Result Param_keepValue(Param_ValueSet* set, Param_Value* value) {
+    const char* str;
+    Str_LenType len;
+
+    switch (value->Type) {
+        case Param_ValueType_String:
+        case Param_ValueType_Null:
+        case Param_ValueType_Unknown:
+            str = value->String;
+            len = Str_len(str);
+            break;
+        case Param_ValueType_StringView:
+        case Param_ValueType_NullView:
+        case Param_ValueType_UnknownView:
+            str = value->StringView;
+            len = value->Len;
+            break;
+        default:
+            return Param_Ok;
+    }
+    if (set->Arena == NULL) {
+        return Param_Ok;
+    }
+    if (set->ArenaSize - set->ArenaLen < (uint32_t) len + 1) {
+        return Param_Error;
+    }
+    value->String = &set->Arena[set->ArenaLen];
+    memcpy(value->String, str, (size_t) len);
+    value->String[len] = '\0';
+    set->ArenaLen += (uint32_t) len + 1;
+    return Param_Ok;
+}
+/**
+ * @brief add value to set, if value exists only count of it increase
+ *
+ * @param set
+ * @param value
+ * @return Param_ValueEntry* entry of value, or NULL if set or arena is full, set not change on failure
+ */
+Param_ValueEntry* Param_addValue(Param_ValueSet* set, Param_Value* value) {
+    Param_ValueEntry* entry;
+    Param_Value copy;
+    uint32_t hash;
+
+    if (set->Size == 0) {
+        return NULL;
+    }
+    hash = Param_hashValue(value);
+    entry = Param_findEntry(set, value, hash);
+    if (entry->Count == 0) {
+        // at least one entry stay empty to end probes
+        if (set->Len >= set->Size - (set->Size >> 2) || set->Len + 1 >= set->Size) {
+            return NULL;
+        }
+        // empty entry end probes, so write it only when value is kept
+        copy = *value;
+        if (Param_keepValue(set, &copy) != Param_Ok) {
+            return NULL;
+        }
+        entry->Value = copy;
+        entry->Hash = hash;
+        set->Len++;
+    }
+    if (entry->Count != UINT32_MAX) {
+        entry->Count++;
+    }
+    return entry;
+}
+/**
+ * @brief find value in set
+ *
+ * @param set
+ * @param value
+ * @return Param_ValueEntry* entry of value, or NULL if value not exists
+ */
+Param_ValueEntry* Param_findValue(Param_ValueSet* set, Param_Value* value) {
+    Param_ValueEntry* entry;
+
+    if (set->Size == 0) {
+        return NULL;
+    }
+    entry = Param_findEntry(set, value, Param_hashValue(value));
+    return entry->Count != 0 ? entry : NULL;
+}
+/**
+ * @brief initialize value map, data of each key is zero when key added
+ *
+ * @param map
+ * @param entries
+ * @param data array with same size of entries
+ * @param size size of entries and data
+ * @param arena storage of strings, can be NULL
+ * @param arenaSize size of arena
+ */
+void Param_initValueMap(Param_ValueMap* map, Param_ValueEntry* entries, Param_ValueData* data, uint32_t size, char* arena, uint32_t arenaSize) {
+    map->Data = data;
+    Param_initValueSet(&map->Keys, entries, size, arena, arenaSize);
+}
+/**
+ * @brief remove all keys of map
+ *
+ * @param map
+ */
+void Param_clearValueMap(Param_ValueMap* map) {
+    Param_clearValueSet(&map->Keys);
+}
+/**
+ * @brief add key to map or find it
+ *
+ * @param map
+ * @param key
+ * @return Param_ValueData* data of key, or NULL if map or arena is full
+ */
+Param_ValueData* Param_putKey(Param_ValueMap* map, Param_Value* key) {
+    Param_ValueEntry* entry = Param_addValue(&map->Keys, key);
+    Param_ValueData* data;
+
+    if (entry == NULL) {
+        return NULL;
+    }
+    data = &map->Data[entry - map->Keys.Entries];
+    if (entry->Count == 1) {
+        memset(data, 0, sizeof(Param_ValueData));
+    }
+    return data;
+}
+/**
+ * @brief find data of key
+ *
+ * @param map
+ * @param key
+ * @return Param_ValueData* data of key, or NULL if key not exists
+ */
+Param_ValueData* Param_findKey(Param_ValueMap* map, Param_Value* key) {
+    Param_ValueEntry* entry = Param_findValue(&map->Keys, key);
+    return entry != NULL ? &map->Data[entry - map->Keys.Entries] : NULL;
+}
+
+#endif // PARAM_VALUE_SET
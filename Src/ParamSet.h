@@ -0,0 +1,66 @@
+/**
+ * @file ParamSet.h
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Hash set and hash map of Param_Value
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _PARAM_SET_H_
+#define _PARAM_SET_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "Param.h"
+
+#if PARAM_VALUE_SET
+
+/**
+ * @brief entry of value set
+ */
+typedef struct {
+    Param_Value         Value;      /**< strings point into arena of set, views keep view type and Len with null terminated copy */
+    uint32_t            Hash;       /**< Param_hashValue of value */
+    uint32_t            Count;      /**< number of times value added, 0 for empty entry */
+} Param_ValueEntry;
+/**
+ * @brief open addressing set of values, equality is Param_compareValue
+ * strings of added values are copied to arena, so source buffer can be reused
+ */
+typedef struct {
+    Param_ValueEntry*   Entries;
+    uint32_t            Size;       /**< number of entries, power of 2 */
+    uint32_t            Len;        /**< number of distinct values */
+    char*               Arena;      /**< storage of strings, NULL to keep pointers of added values */
+    uint32_t            ArenaSize;
+    uint32_t            ArenaLen;
+} Param_ValueSet;
+/**
+ * @brief map of values to user data, keys are a value set
+ */
+typedef struct {
+    Param_ValueSet      Keys;
+    Param_ValueData*    Data;       /**< data of each entry, same size as entries */
+} Param_ValueMap;
+
+void Param_initValueSet(Param_ValueSet* set, Param_ValueEntry* entries, uint32_t size, char* arena, uint32_t arenaSize);
+void Param_clearValueSet(Param_ValueSet* set);
+Param_ValueEntry* Param_addValue(Param_ValueSet* set, Param_Value* value);
+Param_ValueEntry* Param_findValue(Param_ValueSet* set, Param_Value* value);
+
+void Param_initValueMap(Param_ValueMap* map, Param_ValueEntry* entries, Param_ValueData* data, uint32_t size, char* arena, uint32_t arenaSize);
+void Param_clearValueMap(Param_ValueMap* map);
+Param_ValueData* Param_putKey(Param_ValueMap* map, Param_Value* key);
+Param_ValueData* Param_findKey(Param_ValueMap* map, Param_Value* key);
+
+#endif // PARAM_VALUE_SET
+
+#ifdef __cplusplus
+};
+#endif /* __cplusplus */
+
+#endif // _PARAM_SET_H_
@@ -0,0 +1,171 @@
+/**
+ * @file ParamSort.c
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Radix sort of Param_Value arrays
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "ParamSort.h"
+
+#if PARAM_SORT
+
+#include <string.h>
+
+/**
+ * @brief number of radix passes, Type, 8 bytes of Key and Class
+ */
+#define PARAM_SORT_PASSES       10
+
+/**
+ * @brief return byte of key for radix pass, passes start from least significant part
+ *
+ * @param key
+ * @param pass
+ * @return uint8_t
+ */
+static uint8_t Param_sortByte(const Param_SortKey* key, uint8_t pass) {
+    if (pass == 0) {
+        return key->Type;
+    }
+    else if (pass == PARAM_SORT_PASSES - 1) {
+        return key->Class;
+    }
+    else {
+        return (uint8_t)(key->Key >> ((pass - 1) * 8));
+    }
+}
+/**
+ * @brief stable merge sort of keys with same prefix by Param_orderValue
+ *
+ * @param values
+ * @param keys
+ * @param tmp scratch with same size of keys
+ * @param len
+ */
+static void Param_sortRun(const Param_Value* values, Param_SortKey* keys, Param_SortKey* tmp, uint32_t len) {
+    Param_SortKey* src = keys;
+    Param_SortKey* dst = tmp;
+    Param_SortKey* swap;
+    uint32_t width;
+    uint32_t lo, mid, hi;
+    uint32_t i, j, k;
+
+    for (width = 1; width < len; width *= 2) {
+        for (lo = 0; lo < len; lo += 2 * width) {
+            mid = lo + width < len ? lo + width : len;
+            hi = lo + 2 * width < len ? lo + 2 * width : len;
+            i = lo;
+            j = mid;
+            k = lo;
+            while (i < mid && j < hi) {
+                dst[k++] = Param_orderValue(&values[src[j].Index], &values[src[i].Index]) < 0 ? src[j++] : src[i++];
+            }
+            while (i < mid) {
+                dst[k++] = src[i++];
+            }
+            while (j < hi) {
+                dst[k++] = src[j++];
+            }
+        }
+        swap = src;
+        src = dst;
+        dst = swap;
+    }
+    if (src != keys) {
+        memcpy(keys, src, len * sizeof(Param_SortKey));
+    }
+}
+/**
+ * @brief sort values in Param_orderValue order with LSD radix sort on Param_sortKey keys,
+ * passes that all keys have same byte are skipped, so sort of small integers only need few passes
+ * strings with same 8 bytes prefix are sorted after radix passes
+ *
+ * @param values
+ * @param len number of values
+ * @param keys scratch array with 2 * len keys, first len keys are keys of sorted values after sort
+ * and Index of each key is index of value before sort
+ */
+void Param_sortValues(Param_Value* values, uint32_t len, Param_SortKey* keys) {
+#if PARAM_SORT_STATIC_HIST
+    static uint32_t hist[PARAM_SORT_PASSES][256];
+#else
+    uint32_t hist[PARAM_SORT_PASSES][256];
+#endif
+    Param_SortKey* src = keys;
+    Param_SortKey* dst = keys + len;
+    Param_SortKey* swap;
+    Param_Value value;
+    uint32_t sum;
+    uint32_t count;
+    uint32_t i, j, k;
+    uint8_t pass;
+
+    if (len < 2) {
+        return;
+    }
+    // keys and histograms of all passes in one scan
+    memset(hist, 0, sizeof(hist));
+    for (i = 0; i < len; i++) {
+        Param_sortKey(&values[i], &src[i]);
+        src[i].Index = i;
+        for (pass = 0; pass < PARAM_SORT_PASSES; pass++) {
+            hist[pass][Param_sortByte(&src[i], pass)]++;
+        }
+    }
+    for (pass = 0; pass < PARAM_SORT_PASSES; pass++) {
+        if (hist[pass][Param_sortByte(&src[0], pass)] == len) {
+            continue;
+        }
+        sum = 0;
+        for (i = 0; i < 256; i++) {
+            count = hist[pass][i];
+            hist[pass][i] = sum;
+            sum += count;
+        }
+        for (i = 0; i < len; i++) {
+            dst[hist[pass][Param_sortByte(&src[i], pass)]++] = src[i];
+        }
+        swap = src;
+        src = dst;
+        dst = swap;
+    }
+    if (src != keys) {
+        memcpy(keys, src, len * sizeof(Param_SortKey));
+    }
+    // strings with same prefix
+    for (i = 0; i < len; i = j) {
+        j = i + 1;
+        if ((keys[i].Class & Param_Category_Mask) == Param_Category_String) {
+            while (j < len && keys[j].Class == keys[i].Class && keys[j].Key == keys[i].Key) {
+                j++;
+            }
+            if (j - i > 1) {
+                Param_sortRun(values, &keys[i], keys + len, j - i);
+            }
+        }
+    }
+    // move values to sorted place in cycles, on copy of indices so keys keep them
+    dst = keys + len;
+    for (i = 0; i < len; i++) {
+        dst[i].Index = keys[i].Index;
+    }
+    for (i = 0; i < len; i++) {
+        if (dst[i].Index == i) {
+            continue;
+        }
+        value = values[i];
+        j = i;
+        while ((k = dst[j].Index) != i) {
+            values[j] = values[k];
+            dst[j].Index = j;
+            j = k;
+        }
+        values[j] = value;
+        dst[j].Index = j;
+    }
+}
+
+#endif // PARAM_SORT
@@ -0,0 +1,30 @@
+/**
+ * @file ParamSort.h
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Radix sort of Param_Value arrays
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _PARAM_SORT_H_
+#define _PARAM_SORT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "Param.h"
+
+#if PARAM_SORT
+
+void Param_sortValues(Param_Value* values, uint32_t len, Param_SortKey* keys);
+
+#endif // PARAM_SORT
+
+#ifdef __cplusplus
+};
+#endif /* __cplusplus */
+
+#endif // _PARAM_SORT_H_
@@ -0,0 +1,305 @@
+/**
+ * @file ParamTape.c
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Compact tape of parsed lines, 8-byte tagged words per param
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "ParamTape.h"
+
+#if PARAM_TAPE
+
+#include <string.h>
+
+#define __tapePayloadMask               ((((uint64_t) 1) << PARAM_TAPE_TAG_SHIFT) - 1)
+#define __tapeSignBit                   (((uint64_t) 1) << (PARAM_TAPE_TAG_SHIFT - 1))
+#define __tapeWord(TAG, PAYLOAD)        (((uint64_t)(TAG) << PARAM_TAPE_TAG_SHIFT) | ((uint64_t)(PAYLOAD) & __tapePayloadMask))
+#define __tapeTag(W)                    ((uint8_t)((W) >> PARAM_TAPE_TAG_SHIFT))
+#define __tapePayload(W)                ((W) & __tapePayloadMask)
+// record header: words in bits 0..23, params in bits 24..39, index of first param in bits 40..55
+#define __tapeRecord(WORDS, LEN, INDEX) __tapeWord(PARAM_TAPE_RECORD, (uint64_t)(WORDS) | ((uint64_t)(uint16_t)(LEN) << 24) | ((uint64_t)(uint16_t)(INDEX) << 40))
+#define __tapeRecordWords(W)            ((uint32_t)((W) & 0xFFFFFF))
+#define __tapeRecordLen(W)              ((Param_LenType)(((W) >> 24) & 0xFFFF))
+#define __tapeRecordIndex(W)            ((Param_LenType)(((W) >> 40) & 0xFFFF))
+// string: offset in bits 0..31, length in bits 32..55
+#define __tapeStrLenMax                 0xFFFFFF
+#define __tapeStrLen(W)                 ((W) >> 32 & __tapeStrLenMax)
+
+/**
+ * @brief initialize tape on words array
+ *
+ * @param tape
+ * @param words
+ * @param size size of words
+ * @param base source buffer that cursors of Param_parseTape point into
+ */
+void Param_initTape(Param_Tape* tape, uint64_t* words, uint32_t size, char* base) {
+    tape->Words = words;
+    tape->Size = size;
+    tape->Base = base;
+    Param_clearTape(tape);
+}
+/**
+ * @brief remove all records of tape
+ *
+ * @param tape
+ */
+void Param_clearTape(Param_Tape* tape) {
+    tape->Len = 0;
+    tape->Records = 0;
+}
+/**
+ * @brief encode value to one or two words
+ *
+ * @param tape
+ * @param word
+ * @param value
+ * @return uint8_t number of words, 0 if string is longer than length field
+ */
+static uint8_t Param_tapeValue(const Param_Tape* tape, uint64_t* word, const Param_Value* value) {
+#define __signedCase(TY) \
+    case Param_ValueType_ ##TY: \
+        num = (uint64_t)(int64_t) value->TY; \
+        isWide = (uint64_t)(int64_t) value->TY + __tapeSignBit > __tapePayloadMask; \
+        break
+#define __unsignedCase(TY) \
+    case Param_ValueType_ ##TY: \
+        num = (uint64_t) value->TY; \
+        isWide = num > __tapePayloadMask; \
+        break
+
+    const char* str = NULL;
+    uint64_t num = 0;
+    size_t len = 0;
+    uint32_t bits32;
+    uint8_t isWide = 0;
+
+    switch (value->Type) {
+        __signedCase(Number);
+        __signedCase(Int8);
+        __signedCase(Int16);
+        __signedCase(Int32);
+        __unsignedCase(UNumber);
+        __unsignedCase(NumberHex);
+        __unsignedCase(NumberBinary);
+        __unsignedCase(UInt8);
+        __unsignedCase(UInt16);
+        __unsignedCase(UInt32);
+    #if PARAM_TYPE_64BIT
+        __signedCase(Int64);
+        __unsignedCase(UInt64);
+        case Param_ValueType_Double:
+            memcpy(&num, &value->Double, sizeof(num));
+            isWide = 1;
+            break;
+    #endif
+        case Param_ValueType_Boolean:
+        case Param_ValueType_State:
+        case Param_ValueType_StateKey:
+            num = value->Boolean;
+            break;
+    #if PARAM_TYPE_ENUM
+        case Param_ValueType_Enum:
+            num = ((uint64_t) value->Enum.Table << 8) | value->Enum.Ordinal;
+            break;
+    #endif
+        case Param_ValueType_Float:
+            memcpy(&bits32, &value->Float, sizeof(bits32));
+            num = bits32;
+            break;
+        case Param_ValueType_String:
+        case Param_ValueType_Null:
+        case Param_ValueType_Unknown:
+            str = value->String;
+            len = strlen(str);
+            break;
+        case Param_ValueType_StringView:
+        case Param_ValueType_NullView:
+        case Param_ValueType_UnknownView:
+            str = value->StringView;
+            len = (size_t) value->Len;
+            break;
+        default:
+            break;
+    }
+    if (str != NULL) {
+        if (len > __tapeStrLenMax) {
+            return 0;
+        }
+        num = (uint64_t) len << 32;
+        // length inline, offset in next word if source is larger than 4GB
+        if ((uint64_t)(str - tape->Base) > 0xFFFFFFFF) {
+            word[0] = __tapeWord(value->Type | PARAM_TAPE_WIDE, num);
+            word[1] = (uint64_t)(str - tape->Base);
+            return 2;
+        }
+        num |= (uint64_t)(str - tape->Base);
+    }
+    else if (isWide) {
+        word[0] = __tapeWord(value->Type | PARAM_TAPE_WIDE, 0);
+        word[1] = num;
+        return 2;
+    }
+    word[0] = __tapeWord(value->Type, num);
+    return 1;
+#undef __signedCase
+#undef __unsignedCase
+}
+/**
+ * @brief parse params of cursor and append them as a record to tape
+ * if tape is full, params that parsed are kept as a record and cursor stay on next param
+ * so the rest of line can continue on a new tape
+ *
+ * @param cursor
+ * @param tape
+ * @return Param_Result Param_Error if tape is full before end of line,
+ * or a string is longer than 0xFFFFFF, then record is not added
+ */
+Param_Result Param_parseTape(Param_Cursor* cursor, Param_Tape* tape) {
+    Param params[PARAM_BATCH_SIZE];
+    uint32_t header = tape->Len;
+    uint32_t pos = tape->Len + 1;
+    Param_LenType index = cursor->Index;
+    Param_LenType count = 0;
+    Param_LenType batch;
+    Param_LenType space;
+    Param_LenType i;
+    uint8_t words;
+
+    // header and at least one param
+    if (tape->Size < tape->Len + 3) {
+        return Param_Error;
+    }
+    do {
+        // each param need 2 words in worst case
+        space = (Param_LenType)((tape->Size - pos) / 2 < PARAM_BATCH_SIZE ? (tape->Size - pos) / 2 : PARAM_BATCH_SIZE);
+        batch = space > 0 ? Param_parseAll(cursor, params, space) : 0;
+        for (i = 0; i < batch; i++) {
+            words = Param_tapeValue(tape, &tape->Words[pos], &params[i].Value);
+            if (words == 0) {
+                return Param_Error;
+            }
+            pos += words;
+        }
+        count += batch;
+    } while (batch == space && space > 0);
+    tape->Words[header] = __tapeRecord(pos - header, count, index);
+    tape->Len = pos;
+    tape->Records++;
+    // tape is full, check line has more params same as Param_next
+    return space == 0 && cursor->Ptr != NULL && (*cursor->Ptr != '\0' || cursor->Len != 0) ? Param_Error : Param_Ok;
+}
+/**
+ * @brief initialize cursor on first record of tape
+ *
+ * @param cursor
+ * @param tape
+ */
+void Param_initTapeCursor(Param_TapeCursor* cursor, const Param_Tape* tape) {
+    cursor->Tape = tape;
+    cursor->Pos = 0;
+    cursor->End = 0;
+    cursor->Index = 0;
+}
+/**
+ * @brief move cursor to next record, rest of current record skip without decode
+ *
+ * @param cursor
+ * @return Param_LenType number of params of record, or -1 if there is no more records
+ */
+Param_LenType Param_nextTapeRecord(Param_TapeCursor* cursor) {
+    uint64_t word;
+
+    if (cursor->End >= cursor->Tape->Len) {
+        return -1;
+    }
+    word = cursor->Tape->Words[cursor->End];
+    cursor->Pos = cursor->End + 1;
+    cursor->End += __tapeRecordWords(word);
+    cursor->Index = __tapeRecordIndex(word);
+    return __tapeRecordLen(word);
+}
+/**
+ * @brief decode next param of current record, strings point into source buffer of tape
+ *
+ * @param cursor
+ * @param param
+ * @return Param* return param, or NULL if there is no more params in record
+ */
+Param* Param_nextTape(Param_TapeCursor* cursor, Param* param) {
+#define __signedCase(TY) \
+    case Param_ValueType_ ##TY: \
+        value->TY = (PARAM_VALUETYPE(TY))(int64_t)(isWide ? num : (num ^ __tapeSignBit) - __tapeSignBit); \
+        break
+#define __unsignedCase(TY) \
+    case Param_ValueType_ ##TY: \
+        value->TY = (PARAM_VALUETYPE(TY)) num; \
+        break
+
+    Param_Value* value = &param->Value;
+    uint64_t word;
+    uint64_t num;
+    uint32_t bits32;
+    uint8_t tag;
+    uint8_t isWide;
+
+    if (cursor->Pos >= cursor->End) {
+        return NULL;
+    }
+    word = cursor->Tape->Words[cursor->Pos++];
+    tag = __tapeTag(word);
+    isWide = (tag & PARAM_TAPE_WIDE) != 0;
+    value->Type = (Param_ValueType)(tag & ~PARAM_TAPE_WIDE);
+    num = __tapePayload(word);
+    if (isWide && value->Type < Param_ValueType_String) {
+        num = cursor->Tape->Words[cursor->Pos++];
+    }
+    switch (value->Type) {
+        __signedCase(Number);
+        __signedCase(Int8);
+        __signedCase(Int16);
+        __signedCase(Int32);
+        __unsignedCase(UNumber);
+        __unsignedCase(NumberHex);
+        __unsignedCase(NumberBinary);
+        __unsignedCase(UInt8);
+        __unsignedCase(UInt16);
+        __unsignedCase(UInt32);
+    #if PARAM_TYPE_64BIT
+        __signedCase(Int64);
+        __unsignedCase(UInt64);
+        case Param_ValueType_Double:
+            memcpy(&value->Double, &num, sizeof(num));
+            break;
+    #endif
+        case Param_ValueType_Boolean:
+        case Param_ValueType_State:
+        case Param_ValueType_StateKey:
+            value->Boolean = (uint8_t) num;
+            break;
+    #if PARAM_TYPE_ENUM
+        case Param_ValueType_Enum:
+            value->Enum.Table = (uint8_t)(num >> 8);
+            value->Enum.Ordinal = (uint8_t) num;
+            break;
+    #endif
+        case Param_ValueType_Float:
+            bits32 = (uint32_t) num;
+            memcpy(&value->Float, &bits32, sizeof(bits32));
+            break;
+        default:
+            // strings, offset in next word for wide tag
+            value->Len = (Str_LenType) __tapeStrLen(num);
+            value->String = cursor->Tape->Base + (isWide ? cursor->Tape->Words[cursor->Pos++] : (num & 0xFFFFFFFF));
+            break;
+    }
+    param->Index = cursor->Index++;
+    return param;
+#undef __signedCase
+#undef __unsignedCase
+}
+
+#endif // PARAM_TAPE
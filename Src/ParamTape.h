@@ -0,0 +1,67 @@
+/**
+ * @file ParamTape.h
+ * @author Ali Mirghasemi (ali.mirghasemi1376@gmail.com)
+ * @brief Compact tape of parsed lines, 8-byte tagged words per param
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _PARAM_TAPE_H_
+#define _PARAM_TAPE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "Param.h"
+
+#if PARAM_TAPE
+
+/**
+ * Each word has a tag in high byte and 56 bits payload:
+ * - record header: number of words, params and index of first param
+ * - integers that fit in 56 bits, Boolean, State, StateKey, Enum and Float bits are inline
+ * - String, Null, Unknown and views: offset into source buffer and length
+ * - other values set wide bit of tag and keep payload in next word
+ */
+#define PARAM_TAPE_TAG_SHIFT            56
+#define PARAM_TAPE_WIDE                 0x80        /**< payload is in next word */
+#define PARAM_TAPE_RECORD               0x7F        /**< tag of record header */
+
+/**
+ * @brief contiguous buffer of records, string params point into source buffer
+ */
+typedef struct {
+    uint64_t*           Words;
+    uint32_t            Len;            /**< number of used words */
+    uint32_t            Size;           /**< size of words */
+    uint32_t            Records;        /**< number of records */
+    char*               Base;           /**< source buffer of params */
+} Param_Tape;
+/**
+ * @brief read params of tape
+ */
+typedef struct {
+    const Param_Tape*   Tape;
+    uint32_t            Pos;            /**< next word */
+    uint32_t            End;            /**< end of current record */
+    Param_LenType       Index;          /**< index of next param */
+} Param_TapeCursor;
+
+void Param_initTape(Param_Tape* tape, uint64_t* words, uint32_t size, char* base);
+void Param_clearTape(Param_Tape* tape);
+Param_Result Param_parseTape(Param_Cursor* cursor, Param_Tape* tape);
+
+void Param_initTapeCursor(Param_TapeCursor* cursor, const Param_Tape* tape);
+Param_LenType Param_nextTapeRecord(Param_TapeCursor* cursor);
+Param* Param_nextTape(Param_TapeCursor* cursor, Param* param);
+
+#endif // PARAM_TAPE
+
+#ifdef __cplusplus
+};
+#endif /* __cplusplus */
+
+#endif // _PARAM_TAPE_H_